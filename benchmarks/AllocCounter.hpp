@@ -0,0 +1,27 @@
+#ifndef ALLOC_COUNTER_HPP
+#define ALLOC_COUNTER_HPP
+
+#include <cstddef>
+#include <string>
+
+#include "Benchmark.hpp"
+#include "../src/infrastructure/memory/AllocationHooks.hpp"
+
+// Links the counting operator new/delete into the benchmark program.
+// Include from exactly one translation unit.
+namespace bench {
+
+// measure() that also reports the heap allocations made by body.
+template <typename Body>
+Result measureAllocations(const std::string& name, std::size_t operations, Body body) {
+    domain::AllocationScope scope;
+    Result result = measure(name, operations, body);
+    auto allocated = scope.delta();
+    result.allocations = allocated.count;
+    result.allocatedBytes = allocated.bytes;
+    return result;
+}
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace bench {
+
+class Stopwatch {
+private:
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point start = Clock::now();
+
+public:
+    void reset() { start = Clock::now(); }
+
+    double seconds() const {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+};
+
+struct Result {
+    static constexpr std::uint64_t kNotCounted = UINT64_MAX;
+
+    std::string name;
+    std::size_t operations;
+    double seconds;
+    std::uint64_t allocations = kNotCounted;  // see AllocCounter.hpp
+    std::uint64_t allocatedBytes = 0;
+
+    double nsPerOp() const { return seconds * 1e9 / static_cast<double>(operations); }
+    double opsPerSecond() const { return static_cast<double>(operations) / seconds; }
+    double allocsPerOp() const {
+        return static_cast<double>(allocations) / static_cast<double>(operations);
+    }
+    double bytesPerOp() const {
+        return static_cast<double>(allocatedBytes) / static_cast<double>(operations);
+    }
+};
+
+template <typename Body>
+Result measure(const std::string& name, std::size_t operations, Body body) {
+    Stopwatch watch;
+    for (std::size_t i = 0; i < operations; ++i) {
+        body(i);
+    }
+    return Result{name, operations, watch.seconds()};
+}
+
+inline void printHeader() {
+    std::printf("%-40s %12s %12s %14s %10s %10s\n", "benchmark", "ops", "ns/op", "ops/s",
+                "allocs/op", "B/op");
+}
+
+inline void printResult(const Result& r) {
+    std::printf("%-40s %12zu %12.1f %14.0f", r.name.c_str(), r.operations, r.nsPerOp(),
+                r.opsPerSecond());
+    if (r.allocations == Result::kNotCounted) std::printf(" %10s %10s\n", "-", "-");
+    else std::printf(" %10.2f %10.1f\n", r.allocsPerOp(), r.bytesPerOp());
+}
+
+// One JSON object per line, for tracking results across runs.
+inline void printJson(const Result& r) {
+    std::printf("{\"name\":\"%s\",\"ops\":%zu,\"ns_per_op\":%.2f,\"ops_per_sec\":%.0f",
+                r.name.c_str(), r.operations, r.nsPerOp(), r.opsPerSecond());
+    if (r.allocations != Result::kNotCounted) {
+        std::printf(",\"allocs_per_op\":%.3f,\"bytes_per_op\":%.1f", r.allocsPerOp(),
+                    r.bytesPerOp());
+    }
+    std::printf("}\n");
+}
+
+} // namespace bench
+
+#endif
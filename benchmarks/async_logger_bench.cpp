@@ -0,0 +1,83 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../src/domain/metrics/LatencyHistogram.hpp"
+#include "../src/infrastructure/console/BufferedConsoleSink.hpp"
+#include "../src/infrastructure/logging/AsyncLogger.hpp"
+#include "../src/infrastructure/logging/ConsoleLogger.hpp"
+
+// Caller-side latency of ILogger::log for ConsoleLogger and AsyncLogger,
+// with the console redirected to /dev/null (or argv[1]).
+static void run(const char* name, domain::ILogger& logger,
+                std::size_t threads, std::size_t perThread)
+{
+    using Clock = std::chrono::steady_clock;
+    auto histogram = std::make_unique<domain::LatencyHistogram>();
+    const std::string message =
+        "Created ticket TKT-1001 (Category=Technical, Priority=High)";
+
+    bench::Stopwatch watch;
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            for (std::size_t i = 0; i < perThread; ++i) {
+                auto start = Clock::now();
+                logger.log(message);
+                histogram->record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()));
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    double seconds = watch.seconds();
+
+    auto snap = histogram->snapshot();
+    std::printf("%-28s %3zu %10zu %10.0f %8lu %8lu %8lu %10lu\n",
+                name, threads, threads * perThread,
+                static_cast<double>(threads * perThread) / seconds,
+                snap.percentile(50), snap.percentile(99), snap.percentile(99.9), snap.max);
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "/dev/null";
+    const std::size_t perThread = argc > 2 ? std::stoul(argv[2]) : 200000;
+
+    std::ofstream out(path);
+    auto& sink = infrastructure::BufferedConsoleSink::getInstance();
+    sink.setOutput(out);
+
+    std::printf("%-28s %3s %10s %10s %8s %8s %8s %10s\n",
+                "logger", "thr", "msgs", "msgs/s", "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+
+    for (std::size_t threads : {1, 4}) {
+        {
+            sink.setPolicy(infrastructure::FlushPolicy::everyLine());
+            infrastructure::ConsoleLogger logger;
+            run("ConsoleLogger (flush/line)", logger, threads, perThread);
+        }
+        sink.setPolicy(infrastructure::FlushPolicy::buffered());
+        {
+            infrastructure::ConsoleLogger logger;
+            run("ConsoleLogger (buffered)", logger, threads, perThread);
+        }
+        {
+            infrastructure::AsyncLogger logger(8192, infrastructure::OverflowPolicy::BLOCK);
+            run("AsyncLogger BLOCK", logger, threads, perThread);
+        }
+        {
+            infrastructure::AsyncLogger logger(8192, infrastructure::OverflowPolicy::DROP);
+            run("AsyncLogger DROP", logger, threads, perThread);
+            logger.flush();
+            std::printf("%-28s dropped %lu\n", "", logger.droppedCount());
+        }
+    }
+
+    sink.setOutput(std::cout);
+    return 0;
+}
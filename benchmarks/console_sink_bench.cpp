@@ -0,0 +1,37 @@
+#include <fstream>
+#include <string>
+
+#include "Benchmark.hpp"
+#include "../src/infrastructure/console/BufferedConsoleSink.hpp"
+
+// Lines per second written to /dev/null (or argv[1]): std::endl per line,
+// as the console classes used to do, versus BufferedConsoleSink.
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "/dev/null";
+    const std::size_t lines = argc > 2 ? std::stoul(argv[2]) : 1000000;
+    const std::string recipient = "alice@example.com";
+    const std::string message = "Your ticket TKT-1001 has been created.";
+
+    std::ofstream out(path);
+    auto& sink = infrastructure::BufferedConsoleSink::getInstance();
+
+    bench::printHeader();
+
+    bench::printResult(bench::measure("endl_per_line", lines, [&](std::size_t) {
+        out << "[Email] Sending to " << recipient << ":\n" << message << std::endl;
+    }));
+
+    sink.setOutput(out);
+    sink.setPolicy(infrastructure::FlushPolicy::everyLine());
+    bench::printResult(bench::measure("sink_every_line", lines, [&](std::size_t) {
+        sink.writeLine("[Email] Sending to ", recipient, ":\n", message);
+    }));
+
+    sink.setPolicy(infrastructure::FlushPolicy::buffered());
+    bench::printResult(bench::measure("sink_buffered_64k", lines, [&](std::size_t) {
+        sink.writeLine("[Email] Sending to ", recipient, ":\n", message);
+    }));
+    sink.setOutput(std::cout);
+
+    return 0;
+}
@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AllocCounter.hpp"
+#include "Benchmark.hpp"
+#include "../src/domain/builder/CustomerBuilder.hpp"
+#include "../src/domain/builder/TicketBuilder.hpp"
+#include "../src/domain/factory/CustomerFactory.hpp"
+#include "../src/domain/factory/TicketFactory.hpp"
+#include "../src/domain/metrics/OperationMetrics.hpp"
+#include "../src/domain/services/CustomerService.hpp"
+#include "../src/domain/services/NotificationService.hpp"
+#include "../src/domain/services/TicketService.hpp"
+#include "../src/domain/tracing/Tracer.hpp"
+#include "../src/infrastructure/repositories/InMemoryCustomerRepository.hpp"
+#include "../src/infrastructure/repositories/InMemoryTicketRepository.hpp"
+
+// ns/op and heap allocations/op of the domain hot paths: repositories,
+// builders, factories, metric recording, tracing spans and services. Services run with three notification
+// channels and a logger that accept everything and do nothing, so the
+// numbers are the cost of the code itself rather than of console output.
+// Usage: core_bench [--ops N] [--filter text] [--json]
+//                   [--max-allocs text=N]...
+// --max-allocs turns the run into an allocation regression check: every
+// benchmark whose name contains text must stay at or below N allocations
+// per operation, otherwise it is reported and core_bench exits with 1.
+
+class QuietLogger : public domain::ILogger {
+public:
+    void log(const std::string&) override {}
+};
+
+class QuietChannel : public domain::INotificationChannel {
+private:
+    std::string name;
+
+public:
+    explicit QuietChannel(std::string channelName) : name(std::move(channelName)) {}
+
+    bool send(const std::string&, const std::string&) override { return true; }
+    std::string getChannelName() const override { return name; }
+};
+
+struct AllocationBudget {
+    std::string match;
+    double maxPerOp;
+};
+
+struct Options {
+    std::size_t operations = 200000;
+    const char* filter = nullptr;
+    bool json = false;
+    std::vector<AllocationBudget> budgets;
+};
+
+class Suite {
+private:
+    Options options;
+    int overBudget = 0;
+
+    void checkBudgets(const bench::Result& result) {
+        for (auto& budget : options.budgets) {
+            if (result.name.find(budget.match) == std::string::npos) continue;
+            if (result.allocsPerOp() <= budget.maxPerOp) continue;
+            std::fprintf(stderr, "FAIL %s: %llu allocations in %zu ops, budget %g/op\n",
+                         result.name.c_str(), static_cast<unsigned long long>(result.allocations),
+                         result.operations, budget.maxPerOp);
+            ++overBudget;
+        }
+    }
+
+public:
+    explicit Suite(const Options& o) : options(o) {
+        if (!options.json) bench::printHeader();
+    }
+
+    std::size_t operations() const { return options.operations; }
+    int failures() const { return overBudget; }
+
+    bool selected(const std::string& name) const {
+        return !options.filter || name.find(options.filter) != std::string::npos;
+    }
+
+    template <typename Body>
+    void run(const std::string& name, std::size_t operations, Body body) {
+        if (!selected(name)) return;
+        auto result = bench::measureAllocations(name, operations, body);
+        if (options.json) bench::printJson(result);
+        else bench::printResult(result);
+        checkBudgets(result);
+    }
+};
+
+static std::vector<std::string> makeIds(const char* prefix, std::size_t count) {
+    std::vector<std::string> ids;
+    ids.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) ids.push_back(prefix + std::to_string(100000 + i));
+    return ids;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0) {
+            options.json = true;
+        } else if (std::strcmp(argv[i], "--ops") == 0 && i + 1 < argc) {
+            options.operations = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--max-allocs") == 0 && i + 1 < argc
+                   && std::strchr(argv[i + 1], '=')) {
+            std::string spec = argv[++i];
+            auto eq = spec.rfind('=');
+            options.budgets.push_back({spec.substr(0, eq), std::strtod(spec.c_str() + eq + 1, nullptr)});
+        } else {
+            std::fprintf(stderr, "usage: %s [--ops N] [--filter text] [--json] [--max-allocs text=N]...\n",
+                         argv[0]);
+            return 2;
+        }
+    }
+    if (options.operations == 0) options.operations = 1;
+
+    Suite suite(options);
+    const std::size_t n = suite.operations();
+    const std::size_t scans = std::max<std::size_t>(n / 10000, 5);
+
+    const std::string customerId = "CUST-100000";
+    const std::string name = "Ada Lovelace";
+    const std::string email = "ada@example.com";
+    const std::string phone = "555-0100";
+    const std::string description = "Printer on floor 3 shows error E42";
+
+    // Repositories: n distinct entries, then lookups and full scans
+    auto customerIds = makeIds("CUST-", n);
+    auto ticketIds = makeIds("TKT-", n);
+    std::vector<std::shared_ptr<domain::Customer>> customers;
+    std::vector<std::shared_ptr<domain::Ticket>> tickets;
+    customers.reserve(n);
+    tickets.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        customers.push_back(domain::CustomerFactory::createCustomer(
+            customerIds[i], name, email, phone, domain::CustomerType::REGULAR));
+        tickets.push_back(domain::TicketFactory::createTicket(
+            ticketIds[i], customerId, description, domain::Priority::MEDIUM,
+            domain::TicketCategory::TECHNICAL));
+    }
+
+    auto& customerRepo = infrastructure::InMemoryCustomerRepository::getInstance();
+    auto& ticketRepo = infrastructure::InMemoryTicketRepository::getInstance();
+
+    suite.run("InMemoryCustomerRepository::save", n,
+              [&](std::size_t i) { customerRepo.save(*customers[i]); });
+    if (!suite.selected("InMemoryCustomerRepository::save")) {
+        for (auto& c : customers) customerRepo.save(*c);
+    }
+    suite.run("InMemoryCustomerRepository::findById", n,
+              [&](std::size_t i) { customerRepo.findById(customerIds[(i * 7919) % n]); });
+    suite.run("InMemoryCustomerRepository::findAll", scans,
+              [&](std::size_t) { customerRepo.findAll(); });
+    suite.run("InMemoryTicketRepository::save", n,
+              [&](std::size_t i) { ticketRepo.save(*tickets[i]); });
+    if (!suite.selected("InMemoryTicketRepository::save")) {
+        for (auto& t : tickets) ticketRepo.save(*t);
+    }
+    suite.run("InMemoryTicketRepository::findById", n,
+              [&](std::size_t i) { ticketRepo.findById(ticketIds[(i * 7919) % n]); });
+    suite.run("InMemoryTicketRepository::findAll", scans,
+              [&](std::size_t) { ticketRepo.findAll(); });
+    customers.clear();
+    tickets.clear();
+
+    // Builders and factories
+    suite.run("CustomerBuilder::build", n, [&](std::size_t i) {
+        domain::CustomerBuilder()
+            .withId(customerIds[i]).withName(name).withEmail(email).withPhone(phone)
+            .withType(domain::CustomerType::PREMIUM)
+            .build();
+    });
+    suite.run("TicketBuilder::build", n, [&](std::size_t i) {
+        domain::TicketBuilder()
+            .withId(ticketIds[i]).withCustomerId(customerId).withDescription(description)
+            .withPriority(domain::Priority::HIGH).withCategory(domain::TicketCategory::BILLING)
+            .withAssignedTo("Agent-001").addTag("new")
+            .build();
+    });
+    suite.run("CustomerFactory::createCustomer", n, [&](std::size_t i) {
+        domain::CustomerFactory::createCustomer(customerIds[i], name, email, phone,
+                                                domain::CustomerType::VIP);
+    });
+    suite.run("TicketFactory::createTicket", n, [&](std::size_t i) {
+        domain::TicketFactory::createTicket(ticketIds[i], customerId, description,
+                                            static_cast<domain::Priority>(i % 4),
+                                            static_cast<domain::TicketCategory>(i % 5));
+    });
+
+    // Metric recording, without and with the clock reads of a service call
+    auto counter = std::make_unique<domain::Counter>();
+    auto histogram = std::make_unique<domain::Histogram>();
+    auto timedMetrics = domain::OperationMetrics::of(domain::OperationType::GET_TICKET);
+    suite.run("Counter::inc", n, [&](std::size_t) { counter->inc(); });
+    suite.run("Histogram::record", n,
+              [&](std::size_t i) { histogram->record(1000 + (i * 7919) % 100000); });
+    suite.run("TimedOperation", n, [&](std::size_t) { domain::TimedOperation timed(timedMetrics); });
+
+    // Tracing spans: off, enabled but not sampled, and recorded
+    auto& tracer = domain::Tracer::getInstance();
+    suite.run("TraceSpan disabled", n, [&](std::size_t) { domain::TraceSpan span("bench"); });
+    tracer.enable(domain::SamplePolicy::oneIn(1u << 30));
+    suite.run("TraceSpan not sampled", n, [&](std::size_t) {
+        domain::TraceSpan span("bench");
+        domain::TraceSpan child("bench.child");
+    });
+    tracer.enable(domain::SamplePolicy::all());
+    suite.run("TraceSpan recorded", n, [&](std::size_t) { domain::TraceSpan span("bench"); });
+    tracer.disable();
+
+    // Services with quiet channels and logger
+    auto logger = std::make_shared<QuietLogger>();
+    logger->setLevel(domain::LogLevel::INFO);
+    auto& notifications = domain::NotificationService::getInstance(logger);
+    notifications.addChannel(std::make_shared<QuietChannel>("Email"));
+    notifications.addChannel(std::make_shared<QuietChannel>("SMS"));
+    notifications.addChannel(std::make_shared<QuietChannel>("Push Notification"));
+    domain::CustomerService customerService(customerRepo, logger);
+    domain::TicketService ticketService(ticketRepo, customerRepo, notifications, logger);
+
+    std::vector<std::string> created;
+    created.reserve(n);
+    suite.run("CustomerService::registerCustomer", n, [&](std::size_t) {
+        customerService.registerCustomer(name, email, phone, domain::CustomerType::REGULAR);
+    });
+    suite.run("TicketService::createTicket", n, [&](std::size_t i) {
+        created.push_back(ticketService.createTicket(customerId, description,
+                                                     static_cast<domain::Priority>(i % 4)));
+    });
+    if (!suite.selected("TicketService::createTicket")) {
+        for (std::size_t i = 0; i < n; ++i) {
+            created.push_back(ticketService.createTicket(customerId, description,
+                                                         static_cast<domain::Priority>(i % 4)));
+        }
+    }
+    suite.run("TicketService::updateTicketStatus", n, [&](std::size_t i) {
+        ticketService.updateTicketStatus(created[i], static_cast<domain::TicketStatus>(i % 4));
+    });
+    if (!created.empty()) suite.run("TicketService::getTicketsPage(50)", scans * 100, [&](std::size_t i) {
+        ticketService.getTicketsPage(created[(i * 7919) % created.size()], 50);
+    });
+    return suite.failures() ? 1 : 0;
+}
@@ -0,0 +1,68 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../src/domain/factory/TicketFactory.hpp"
+#include "../src/infrastructure/export/TicketExporter.hpp"
+#include "../src/infrastructure/repositories/InMemoryTicketRepository.hpp"
+
+// Throughput of TicketExporter for each format, written to a file
+// (default /dev/null) from an in-memory store of generated tickets.
+
+static void run(infrastructure::TicketExporter& exporter, const char* name,
+                const std::string& path, const domain::ExportOptions& options)
+{
+    auto report = exporter.exportTickets(path, options);
+    if (!report.opened || report.writeFailed) {
+        std::printf("%-24s failed\n", name);
+        return;
+    }
+    std::printf("%-24s %10zu %14zu %10zu %10.3f %12.0f %10.2f\n",
+                name, report.rows, report.bytes, report.writes, report.seconds,
+                static_cast<double>(report.rows) / report.seconds,
+                report.bytesPerSecond() / 1e9);
+}
+
+int main(int argc, char** argv) {
+    const std::string path = argc > 1 ? argv[1] : "/dev/null";
+    const std::size_t tickets = argc > 2 ? std::stoul(argv[2]) : 1000000;
+
+    auto& repo = infrastructure::InMemoryTicketRepository::getInstance();
+    std::vector<std::shared_ptr<domain::Ticket>> batch;
+    batch.reserve(tickets);
+    for (std::size_t i = 0; i < tickets; ++i) {
+        auto ticket = domain::TicketFactory::createTicket(
+            "TKT-" + std::to_string(1000000 + i),
+            "CUST-" + std::to_string(1000 + i % 5000),
+            "Printer on floor " + std::to_string(i % 40) +
+                " shows error E" + std::to_string(i % 97) + " after the nightly update",
+            static_cast<domain::Priority>(i % 4),
+            static_cast<domain::TicketCategory>(i % 5));
+        ticket->setStatus(static_cast<domain::TicketStatus>(i % 4));
+        batch.push_back(std::move(ticket));
+    }
+    repo.saveAll(std::move(batch));
+
+    infrastructure::TicketExporter exporter(repo);
+    std::printf("%-24s %10s %14s %10s %10s %12s %10s\n",
+                "format", "rows", "bytes", "writes", "seconds", "rows/s", "GB/s");
+
+    domain::ExportOptions options;
+    options.format = domain::ExportFormat::CSV;
+    run(exporter, "csv", path, options);
+    options.format = domain::ExportFormat::JSON_LINES;
+    run(exporter, "jsonl", path, options);
+    options.format = domain::ExportFormat::BINARY;
+    run(exporter, "binary", path, options);
+
+    options.format = domain::ExportFormat::CSV;
+    options.filter.status = domain::TicketStatus::OPEN;
+    options.filter.category = domain::TicketCategory::TECHNICAL;
+    run(exporter, "csv status+category", path, options);
+
+    options.filter = {};
+    options.compress = true;
+    run(exporter, "csv.gz", path, options);
+    return 0;
+}
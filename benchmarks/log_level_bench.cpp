@@ -0,0 +1,74 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../src/domain/services/CustomerService.hpp"
+#include "../src/domain/services/NotificationService.hpp"
+#include "../src/domain/services/TicketService.hpp"
+#include "../src/infrastructure/console/BufferedConsoleSink.hpp"
+#include "../src/infrastructure/logging/ConsoleLogger.hpp"
+#include "../src/infrastructure/repositories/InMemoryCustomerRepository.hpp"
+
+// Cost of TicketService::createTicket with logging enabled, disabled at
+// runtime, and without a logger. Build a second time with
+// -DLOG_COMPILE_LEVEL=LOG_LEVEL_OFF to measure the compiled-out case.
+
+// Discards tickets so the repository does not dominate the measurement.
+class NullTicketRepository : public domain::ITicketRepository {
+public:
+    void save(const domain::Ticket&) override {}
+    std::shared_ptr<domain::Ticket> findById(const std::string&) override { return nullptr; }
+    std::vector<std::shared_ptr<domain::Ticket>> findAll() override { return {}; }
+};
+
+static bench::Result run(const std::string& name, std::shared_ptr<domain::ILogger> logger,
+                         const std::string& customerId, std::size_t operations)
+{
+    NullTicketRepository tickets;
+    auto& customers = infrastructure::InMemoryCustomerRepository::getInstance();
+    auto& notifications = domain::NotificationService::getInstance();
+    domain::TicketService service(tickets, customers, notifications, logger);
+
+    return bench::measure(name, operations, [&](std::size_t) {
+        service.createTicket(customerId, "Printer on fire", domain::Priority::HIGH,
+                             domain::TicketCategory::TECHNICAL);
+    });
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "/dev/null";
+    const std::size_t operations = argc > 2 ? std::stoul(argv[2]) : 500000;
+
+    std::ofstream out(path);
+    auto& sink = infrastructure::BufferedConsoleSink::getInstance();
+    sink.setOutput(out);
+    sink.setPolicy(infrastructure::FlushPolicy::buffered());
+
+    auto& customers = infrastructure::InMemoryCustomerRepository::getInstance();
+    domain::CustomerService customerService(customers, nullptr);
+    auto customerId = customerService.registerCustomer(
+        "Bench", "bench@example.com", "555-0100", domain::CustomerType::REGULAR);
+
+    std::printf("LOG_COMPILE_LEVEL=%d\n", LOG_COMPILE_LEVEL);
+    bench::printHeader();
+
+    auto logger = std::make_shared<infrastructure::ConsoleLogger>();
+
+    logger->setLevel(domain::LogLevel::INFO);
+    bench::printResult(run("ConsoleLogger level=INFO", logger, customerId, operations));
+
+    logger->setLevel(domain::LogLevel::WARN);
+    bench::printResult(run("ConsoleLogger level=WARN", logger, customerId, operations));
+
+    logger->setLevel(domain::LogLevel::OFF);
+    bench::printResult(run("ConsoleLogger level=OFF", logger, customerId, operations));
+
+    bench::printResult(run("no logger", nullptr, customerId, operations));
+
+    sink.flush();
+    sink.setOutput(std::cout);
+    return 0;
+}
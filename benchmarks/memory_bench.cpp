@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../src/domain/factory/CustomerFactory.hpp"
+#include "../src/domain/factory/TicketFactory.hpp"
+#include "../src/infrastructure/repositories/InMemoryCustomerRepository.hpp"
+#include "../src/infrastructure/repositories/InMemoryTicketRepository.hpp"
+
+// Bytes per stored customer and ticket. The stores are grown to each
+// requested size in turn, and at every size the breakdown reported by
+// memoryUsage() is printed next to the measured growth in resident set
+// size, all divided by the number of entries. Customers are filled before
+// tickets, so each store's RSS growth is its own.
+// Usage: memory_bench [--json] [--store customers|tickets] [entries...]
+//        (default both stores at 1000000 and 10000000; at 10M they need
+//        about 8 GB together, --store measures one at a time)
+
+static std::size_t residentBytes() {
+    FILE* f = std::fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+    unsigned long size = 0, resident = 0;
+    int fields = std::fscanf(f, "%lu %lu", &size, &resident);
+    std::fclose(f);
+    return fields == 2 ? resident * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)) : 0;
+}
+
+struct Store {
+    const char* name;
+    std::size_t resident = 0;  // RSS growth while filling
+};
+
+static void print(const Store& store, const domain::MemoryUsage& u, bool json) {
+    double n = u.entries ? static_cast<double>(u.entries) : 1.0;
+    auto per = [n](std::size_t bytes) { return static_cast<double>(bytes) / n; };
+    if (json) {
+        std::printf("{\"store\":\"%s\",\"entries\":%zu,\"index\":%.1f,\"entity\":%.1f,"
+                    "\"strings\":%.1f,\"tags\":%.1f,\"total\":%.1f,\"resident\":%.1f}\n",
+                    store.name, u.entries, per(u.indexBytes), per(u.entityBytes),
+                    per(u.stringBytes), per(u.tagBytes), per(u.total()), per(store.resident));
+        return;
+    }
+    std::printf("%-10s %10zu %8.1f %8.1f %8.1f %8.1f %8.1f %10.1f\n", store.name, u.entries,
+                per(u.indexBytes), per(u.entityBytes), per(u.stringBytes), per(u.tagBytes),
+                per(u.total()), per(store.resident));
+}
+
+// Adds entries [from, to) in saveAll batches, charging the RSS growth to
+// store.
+template <typename Make, typename Save>
+static void grow(Store& store, std::size_t from, std::size_t to, Make make, Save save) {
+    constexpr std::size_t kBatch = 4096;
+    std::size_t rssBefore = residentBytes();
+    for (std::size_t begin = from; begin < to; begin += kBatch) {
+        std::size_t end = std::min(to, begin + kBatch);
+        std::vector<decltype(make(begin))> batch;
+        batch.reserve(end - begin);
+        for (std::size_t i = begin; i < end; ++i) batch.push_back(make(i));
+        save(std::move(batch));
+    }
+    std::size_t rssAfter = residentBytes();
+    if (rssAfter > rssBefore) store.resident += rssAfter - rssBefore;
+}
+
+int main(int argc, char** argv) {
+    bool json = false;
+    const char* only = nullptr;
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0) json = true;
+        else if (std::strcmp(argv[i], "--store") == 0 && i + 1 < argc) only = argv[++i];
+        else sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+    }
+    bool withCustomers = !only || std::strcmp(only, "customers") == 0;
+    bool withTickets = !only || std::strcmp(only, "tickets") == 0;
+    if (sizes.empty()) sizes = {1000000, 10000000};
+
+    auto& customerRepo = infrastructure::InMemoryCustomerRepository::getInstance();
+    auto& ticketRepo = infrastructure::InMemoryTicketRepository::getInstance();
+    Store customers{"customers"};
+    Store tickets{"tickets"};
+
+    auto makeCustomer = [](std::size_t i) {
+        return domain::CustomerFactory::createCustomer(
+            "CUST-" + std::to_string(1000000 + i), "Customer " + std::to_string(i),
+            "customer" + std::to_string(i) + "@example.com", "555-" + std::to_string(i % 10000),
+            static_cast<domain::CustomerType>(i % 3));
+    };
+    auto makeTicket = [](std::size_t i) {
+        auto ticket = domain::TicketFactory::createTicket(
+            "TKT-" + std::to_string(1000000 + i), "CUST-" + std::to_string(1000000 + i / 4),
+            "Printer on floor " + std::to_string(i % 40) + " shows error E" +
+                std::to_string(i % 97) + " after the nightly update",
+            static_cast<domain::Priority>(i % 4), static_cast<domain::TicketCategory>(i % 5));
+        if (i % 3 == 0) ticket->setAssignedTo("Agent-" + std::to_string(i % 50));
+        return ticket;
+    };
+
+    if (!json) {
+        std::printf("%-10s %10s %8s %8s %8s %8s %8s %10s\n", "store", "entries", "index",
+                    "entity", "strings", "tags", "total", "resident");
+        std::printf("%-10s %10s %8s %8s %8s %8s %8s %10s\n", "", "", "B/entry", "B/entry",
+                    "B/entry", "B/entry", "B/entry", "B/entry");
+    }
+    std::size_t filled = 0;
+    for (std::size_t size : sizes) {
+        if (size <= filled) continue;
+        if (withCustomers) {
+            grow(customers, filled, size, makeCustomer,
+                 [&](auto batch) { customerRepo.saveAll(std::move(batch)); });
+            print(customers, customerRepo.memoryUsage(), json);
+        }
+        if (withTickets) {
+            grow(tickets, filled, size, makeTicket,
+                 [&](auto batch) { ticketRepo.saveAll(std::move(batch)); });
+            print(tickets, ticketRepo.memoryUsage(), json);
+        }
+        filled = size;
+        std::fflush(stdout);
+    }
+    return 0;
+}
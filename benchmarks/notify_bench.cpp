@@ -0,0 +1,124 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/domain/services/NotificationService.hpp"
+#include "../src/infrastructure/async/EventLoop.hpp"
+#include "../src/infrastructure/notifications/ChannelAdapters.hpp"
+
+// Many async channels in flight on one event loop thread. Every channel
+// takes --delay ms to complete a send, like a network call, so delivering
+// to N channels one at a time would take N times that. Checks that
+// notify() and notifyAsync() overlap the sends (each round finishes within
+// a few delays) and that AsyncToSyncChannel is safe to call from several
+// threads at once; exits with 1 otherwise.
+// Usage: notify_bench [channels] [notifications] [delay ms]
+
+using Clock = std::chrono::steady_clock;
+
+class QuietLogger : public domain::ILogger {
+public:
+    void log(const std::string&) override {}
+};
+
+class DelayedChannel : public domain::IAsyncNotificationChannel {
+private:
+    std::string name;
+    std::chrono::milliseconds delay;
+    std::atomic<std::size_t>& delivered;
+
+public:
+    DelayedChannel(std::string channelName, std::chrono::milliseconds sendDelay,
+                   std::atomic<std::size_t>& counter)
+        : name(std::move(channelName)), delay(sendDelay), delivered(counter) {}
+
+    domain::Task<bool> sendAsync(std::string, std::string) override {
+        co_await infrastructure::EventLoop::sleepFor(delay);
+        delivered.fetch_add(1, std::memory_order_relaxed);
+        co_return true;
+    }
+
+    std::string getChannelName() const override { return name; }
+};
+
+static double elapsedMs(Clock::time_point from) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - from).count();
+}
+
+static bool check(const char* name, std::size_t delivered, std::size_t expected, double ms,
+                  double limitMs)
+{
+    bool ok = delivered == expected && ms <= limitMs;
+    std::printf("%-28s %8zu/%-8zu %10.1f ms  (limit %.0f ms)  %s\n", name, delivered, expected,
+                ms, limitMs, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t channels = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+    const std::size_t notifications = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5;
+    const auto delay = std::chrono::milliseconds(argc > 3 ? std::atoi(argv[3]) : 50);
+    // Generous for a loaded host, far below the channels * delay of sending in turn
+    const double limitMs = 10.0 * static_cast<double>(delay.count()) + 1000.0;
+    bool ok = true;
+
+    auto loop = std::make_shared<infrastructure::EventLoop>();
+    auto& service = domain::NotificationService::getInstance(std::make_shared<QuietLogger>());
+    service.setExecutor(loop);
+
+    std::atomic<std::size_t> delivered{0};
+    for (std::size_t i = 0; i < channels; ++i) {
+        service.addChannel(std::shared_ptr<domain::IAsyncNotificationChannel>(
+            std::make_shared<DelayedChannel>("delayed-" + std::to_string(i), delay, delivered)));
+    }
+
+    // notify(): fire and forget onto the loop thread
+    std::thread loopThread([&] { loop->runUntilStopped(); });
+    auto start = Clock::now();
+    for (std::size_t n = 0; n < notifications; ++n) {
+        service.notify("alice@example.com", "Your ticket TKT-1001 has been created.");
+    }
+    while (delivered.load(std::memory_order_relaxed) < channels * notifications &&
+           elapsedMs(start) < 10 * limitMs) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ok &= check("notify", delivered.load(), channels * notifications, elapsedMs(start), limitMs);
+    loop->stop();
+    loopThread.join();
+
+    // notifyAsync(): awaits every channel of one notification together
+    delivered.store(0);
+    start = Clock::now();
+    std::size_t reported = 0;
+    for (std::size_t n = 0; n < notifications; ++n) {
+        reported += loop->syncWait(service.notifyAsync("alice@example.com", "Resolved."));
+    }
+    ok &= check("notifyAsync", reported, channels * notifications, elapsedMs(start),
+                static_cast<double>(notifications) * limitMs);
+
+    // AsyncToSyncChannel from several threads at once
+    std::atomic<std::size_t> syncDelivered{0};
+    infrastructure::AsyncToSyncChannel blocking(
+        std::make_shared<DelayedChannel>("blocking", std::chrono::milliseconds(1), syncDelivered));
+    constexpr std::size_t kThreads = 8, kSends = 100;
+    std::atomic<std::size_t> succeeded{0};
+    std::vector<std::thread> senders;
+    start = Clock::now();
+    for (std::size_t t = 0; t < kThreads; ++t) {
+        senders.emplace_back([&] {
+            for (std::size_t i = 0; i < kSends; ++i) {
+                if (blocking.send("bob@example.com", "ping")) succeeded.fetch_add(1);
+            }
+        });
+    }
+    for (auto& s : senders) s.join();
+    ok &= check("AsyncToSync x8 threads", succeeded.load(), kThreads * kSends, elapsedMs(start),
+                static_cast<double>(kSends) * 1000.0);
+
+    return ok ? 0 : 1;
+}
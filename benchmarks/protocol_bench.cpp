@@ -0,0 +1,133 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "Benchmark.hpp"
+#include "../src/client/BinaryProtocolHandler.hpp"
+#include "../src/client/CommandProcessor.hpp"
+#include "../src/client/HttpApiHandler.hpp"
+#include "../src/client/LineProtocolHandler.hpp"
+#include "../src/domain/services/CustomerService.hpp"
+#include "../src/domain/services/NotificationService.hpp"
+#include "../src/domain/services/TicketService.hpp"
+#include "../src/infrastructure/repositories/InMemoryCustomerRepository.hpp"
+#include "../src/infrastructure/repositories/InMemoryTicketRepository.hpp"
+
+// Server-side cost per operation of the line, HTTP and binary protocols:
+// the same createTicket and updateTicketStatus calls are encoded once in
+// each protocol and fed to its handler in 1024-operation receive buffers,
+// without sockets. No notification channels are registered and created
+// tickets are discarded, so the difference between rows is decoding and
+// reply encoding.
+
+static constexpr std::size_t kOpsPerBuffer = 1024;
+
+// Discards tickets so the store does not grow between runs.
+class NullTicketRepository : public domain::ITicketRepository {
+public:
+    void save(const domain::Ticket&) override {}
+    std::shared_ptr<domain::Ticket> findById(const std::string&) override { return nullptr; }
+    std::vector<std::shared_ptr<domain::Ticket>> findAll() override { return {}; }
+};
+
+struct Handlers {
+    client::CommandProcessor processor;
+    client::LineProtocolHandler line;
+    client::HttpApiHandler http;
+    client::BinaryProtocolHandler binary;
+
+    Handlers(std::shared_ptr<domain::CustomerService> customers,
+             std::shared_ptr<domain::TicketService> tickets,
+             domain::NotificationService& notifications)
+        : processor(customers, tickets, notifications), line(processor),
+          http(customers, tickets, notifications), binary(customers, tickets) {}
+};
+
+static void run(const std::string& name, domain::IRequestHandler& handler,
+                const std::string& input, std::size_t rounds)
+{
+    std::string out;
+    out.reserve(1 << 20);
+    bench::Stopwatch watch;
+    for (std::size_t i = 0; i < rounds; ++i) {
+        out.clear();
+        auto result = handler.handle(input, out);
+        if (result.consumed != input.size() || result.close) {
+            std::printf("%s: request rejected\n", name.c_str());
+            return;
+        }
+    }
+    double seconds = watch.seconds();
+    char label[64];
+    std::snprintf(label, sizeof(label), "%s (%zu B/op)", name.c_str(),
+                  input.size() / kOpsPerBuffer);
+    bench::printResult({label, rounds * kOpsPerBuffer, seconds});
+}
+
+static std::string binaryFrames(infrastructure::wire::Opcode opcode, std::size_t batch,
+                                const std::string& id)
+{
+    std::string input;
+    for (std::size_t done = 0; done < kOpsPerBuffer; done += batch) {
+        infrastructure::wire::FrameWriter writer(input, opcode, static_cast<std::uint16_t>(batch));
+        for (std::size_t i = 0; i < batch; ++i) {
+            writer.str(id);
+            if (opcode == infrastructure::wire::Opcode::CREATE_TICKET) {
+                writer.str("Printer on fire");
+                writer.u8(2);
+                writer.u8(0);
+            } else {
+                writer.u8(static_cast<std::uint8_t>(i % 4));
+            }
+        }
+        writer.finish();
+    }
+    return input;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t rounds = argc > 1 ? std::stoul(argv[1]) : 200;
+
+    auto& customerRepo = infrastructure::InMemoryCustomerRepository::getInstance();
+    auto& ticketRepo = infrastructure::InMemoryTicketRepository::getInstance();
+    auto& notifications = domain::NotificationService::getInstance();
+    auto customers = std::make_shared<domain::CustomerService>(customerRepo, nullptr);
+    auto tickets = std::make_shared<domain::TicketService>(ticketRepo, customerRepo,
+                                                           notifications, nullptr);
+    NullTicketRepository discard;
+    auto creator = std::make_shared<domain::TicketService>(discard, customerRepo,
+                                                           notifications, nullptr);
+    Handlers status(customers, tickets, notifications);
+    Handlers create(customers, creator, notifications);
+
+    auto customerId = customers->registerCustomer("Bench", "bench@example.com", "555-0100");
+    auto ticketId = tickets->createTicket(customerId, "Printer on fire", domain::Priority::HIGH);
+
+    std::string lineStatus, httpStatus, lineCreate, httpCreate;
+    std::string createBody = "{\"customer_id\":\"" + customerId +
+                             "\",\"description\":\"Printer on fire\",\"priority\":2,\"category\":0}";
+    for (std::size_t i = 0; i < kOpsPerBuffer; ++i) {
+        lineStatus += "status|" + ticketId + "|" + std::to_string(i % 4) + "\n";
+        httpStatus += "PUT /tickets/" + ticketId + "/status HTTP/1.1\r\nContent-Length: 12\r\n\r\n"
+                      "{\"status\":" + std::to_string(i % 4) + "}";
+        lineCreate += "ticket|" + customerId + "|Printer on fire|2|0\n";
+        httpCreate += "POST /tickets HTTP/1.1\r\nContent-Length: " +
+                      std::to_string(createBody.size()) + "\r\n\r\n" + createBody;
+    }
+
+    using infrastructure::wire::Opcode;
+    bench::printHeader();
+    run("status line", status.line, lineStatus, rounds);
+    run("status http", status.http, httpStatus, rounds);
+    run("status bin batch=1", status.binary,
+        binaryFrames(Opcode::UPDATE_STATUS, 1, ticketId), rounds);
+    run("status bin batch=64", status.binary,
+        binaryFrames(Opcode::UPDATE_STATUS, 64, ticketId), rounds);
+    run("create line", create.line, lineCreate, rounds);
+    run("create http", create.http, httpCreate, rounds);
+    run("create bin batch=1", create.binary,
+        binaryFrames(Opcode::CREATE_TICKET, 1, customerId), rounds);
+    run("create bin batch=64", create.binary,
+        binaryFrames(Opcode::CREATE_TICKET, 64, customerId), rounds);
+    return 0;
+}
@@ -0,0 +1,404 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/domain/metrics/LatencyHistogram.hpp"
+#include "../src/domain/services/CustomerService.hpp"
+#include "../src/domain/services/NotificationService.hpp"
+#include "../src/domain/services/TicketService.hpp"
+#include "../src/infrastructure/net/FlatJson.hpp"
+#include "../src/infrastructure/repositories/InMemoryCustomerRepository.hpp"
+#include "../src/infrastructure/repositories/InMemoryTicketRepository.hpp"
+
+// Latency percentiles of the services under a fixed open-loop arrival
+// rate. Each thread issues operations on a fixed schedule (rate / threads
+// per second) regardless of how long earlier ones took. Latency is measured
+// from the scheduled start, not the actual one, which corrects for
+// coordinated omission: when a call stalls, the calls queued behind it are
+// charged the wait. The uncorrected service time is reported next to it.
+//
+// Every rate in --rates is one step of --duration seconds, the first
+// --warmup seconds of which are not recorded, so a sweep gives the
+// throughput-vs-latency curve. When a rate is beyond capacity, calls still
+// due at the end of a step are counted as unissued and recorded with the
+// time they had waited, making their percentiles lower bounds.
+//
+// --json prints one object per rate and operation. With --baseline, the
+// p50/p99/p99.9 of each rate and operation are compared against a file
+// from an earlier --json run and the run exits with 1 if any is more than
+// --tolerance (a fraction) slower. Percentiles without enough samples in
+// either run to be stable are skipped and listed.
+//
+// Usage: slo_bench [--rates R1,R2,...] [--duration S] [--warmup S]
+//   [--threads T] [--mix R,C,U,L] [--customers N] [--json]
+//   [--baseline file] [--tolerance X]
+
+using Clock = std::chrono::steady_clock;
+
+class QuietLogger : public domain::ILogger {
+public:
+    void log(const std::string&) override {}
+};
+
+class QuietChannel : public domain::INotificationChannel {
+private:
+    std::string name;
+
+public:
+    explicit QuietChannel(std::string channelName) : name(std::move(channelName)) {}
+
+    bool send(const std::string&, const std::string&) override { return true; }
+    std::string getChannelName() const override { return name; }
+};
+
+// registerCustomer, createTicket, updateTicketStatus, getTicketsPage
+static constexpr std::size_t kOps = 4;
+static constexpr domain::OperationType kOpTypes[kOps] = {
+    domain::OperationType::REGISTER_CUSTOMER, domain::OperationType::CREATE_TICKET,
+    domain::OperationType::UPDATE_STATUS, domain::OperationType::TICKETS_PAGE};
+
+struct Config {
+    std::vector<double> rates{5000, 10000, 20000, 40000, 80000};
+    double duration = 5;
+    double warmup = 1;
+    std::size_t threads = 1;
+    std::array<double, kOps> mix{10, 40, 40, 10};
+    std::size_t customers = 10000;
+    bool json = false;
+    const char* baseline = nullptr;
+    double tolerance = 0.25;
+};
+
+struct Services {
+    domain::CustomerService& customers;
+    domain::TicketService& tickets;
+    std::size_t customerCount;
+};
+
+struct Step {
+    double rate = 0;
+    double seconds = 0;  // recorded part of the step
+    std::array<std::unique_ptr<domain::LatencyHistogram>, kOps> latency;  // from schedule
+    std::array<std::unique_ptr<domain::LatencyHistogram>, kOps> service;  // from actual start
+    std::array<std::atomic<std::uint64_t>, kOps> unissued{};
+
+    Step() {
+        for (auto& h : latency) h = std::make_unique<domain::LatencyHistogram>();
+        for (auto& h : service) h = std::make_unique<domain::LatencyHistogram>();
+    }
+};
+
+static std::uint64_t elapsedNs(Clock::time_point from, Clock::time_point to) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+}
+
+// Sleeps most of the way and spins the rest, since sleeps overshoot by tens
+// of microseconds.
+static void waitUntil(Clock::time_point due) {
+    constexpr auto kSpin = std::chrono::microseconds(200);
+    auto now = Clock::now();
+    if (due - now > kSpin) std::this_thread::sleep_until(due - kSpin);
+    while (Clock::now() < due) std::this_thread::yield();
+}
+
+static void runWorker(const Config& config, Services& services, Step& step, std::size_t index,
+                      Clock::time_point start, Clock::time_point recordFrom, Clock::time_point end)
+{
+    static constexpr std::size_t kTracked = 1 << 14;
+    std::mt19937_64 rng(index * 7919 + static_cast<std::uint64_t>(step.rate));
+    std::discrete_distribution<std::size_t> pick(config.mix.begin(), config.mix.end());
+    std::vector<std::string> tracked;
+    tracked.reserve(kTracked);
+    std::size_t replace = 0;
+
+    auto interval = std::chrono::nanoseconds(
+        static_cast<std::int64_t>(1e9 * static_cast<double>(config.threads) / step.rate));
+    auto due = start + interval * static_cast<std::int64_t>(index) / static_cast<std::int64_t>(config.threads);
+    for (; due < end; due += interval) {
+        std::size_t op = pick(rng);
+        if ((op == 2 || op == 3) && tracked.empty()) op = 1;
+        if (Clock::now() >= end) {
+            if (due >= recordFrom) {
+                step.latency[op]->record(elapsedNs(due, end));
+                step.unissued[op].fetch_add(1, std::memory_order_relaxed);
+            }
+            continue;
+        }
+        waitUntil(due);
+
+        auto begin = Clock::now();
+        switch (op) {
+        case 0:
+            services.customers.registerCustomer("Load Test", "load@example.com", "555-0199",
+                                                domain::CustomerType::REGULAR);
+            break;
+        case 1: {
+            auto customer = "CUST-" + std::to_string(1001 + rng() % services.customerCount);
+            auto id = services.tickets.createTicket(customer, "Printer on floor 3 shows error E42",
+                                                    static_cast<domain::Priority>(rng() % 4));
+            if (tracked.size() < kTracked) tracked.push_back(std::move(id));
+            else tracked[replace++ % kTracked] = std::move(id);
+            break;
+        }
+        case 2:
+            services.tickets.updateTicketStatus(tracked[rng() % tracked.size()],
+                                                static_cast<domain::TicketStatus>(rng() % 4));
+            break;
+        default:
+            services.tickets.getTicketsPage(tracked[rng() % tracked.size()], 50);
+            break;
+        }
+        auto done = Clock::now();
+        if (due >= recordFrom) {
+            step.latency[op]->record(elapsedNs(due, done));
+            step.service[op]->record(elapsedNs(begin, done));
+        }
+    }
+}
+
+static void runStep(const Config& config, Services& services, Step& step) {
+    auto start = Clock::now() + std::chrono::milliseconds(10);
+    auto recordFrom = start + std::chrono::nanoseconds(static_cast<std::int64_t>(config.warmup * 1e9));
+    auto end = start + std::chrono::nanoseconds(static_cast<std::int64_t>(config.duration * 1e9));
+    step.seconds = std::max(config.duration - config.warmup, 1e-9);
+
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < config.threads; ++t) {
+        workers.emplace_back([&, t] { runWorker(config, services, step, t, start, recordFrom, end); });
+    }
+    for (auto& w : workers) w.join();
+}
+
+static void merge(domain::HistogramSnapshot& into, const domain::HistogramSnapshot& from) {
+    into.count += from.count;
+    into.sum += from.sum;
+    into.max = std::max(into.max, from.max);
+    for (std::size_t i = 0; i < into.buckets.size(); ++i) into.buckets[i] += from.buckets[i];
+}
+
+struct Row {
+    double rate;
+    std::string op;
+    std::uint64_t count;
+    std::uint64_t unissued;
+    double throughput;
+    double p50, p99, p999, max, serviceP99;  // microseconds
+};
+
+static Row makeRow(const Step& step, const std::string& op, const domain::HistogramSnapshot& latency,
+                   const domain::HistogramSnapshot& service, std::uint64_t unissued)
+{
+    auto us = [](std::uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+    std::uint64_t completed = latency.count - unissued;
+    return {step.rate, op, latency.count, unissued,
+            static_cast<double>(completed) / step.seconds,
+            us(latency.percentile(50)), us(latency.percentile(99)), us(latency.percentile(99.9)),
+            us(latency.max), us(service.percentile(99))};
+}
+
+static std::vector<Row> report(const Step& step) {
+    std::vector<Row> rows;
+    domain::HistogramSnapshot allLatency = step.latency[0]->snapshot();
+    domain::HistogramSnapshot allService = step.service[0]->snapshot();
+    std::uint64_t allUnissued = 0;
+    for (std::size_t op = 0; op < kOps; ++op) {
+        auto latency = step.latency[op]->snapshot();
+        auto service = step.service[op]->snapshot();
+        auto unissued = step.unissued[op].load();
+        if (op > 0) {
+            merge(allLatency, latency);
+            merge(allService, service);
+        }
+        allUnissued += unissued;
+        if (latency.count) {
+            rows.push_back(makeRow(step, domain::operationName(kOpTypes[op]), latency, service, unissued));
+        }
+    }
+    rows.push_back(makeRow(step, "all", allLatency, allService, allUnissued));
+    return rows;
+}
+
+static void printRow(const Row& r, bool json) {
+    if (json) {
+        std::printf("{\"rate\":%.0f,\"op\":\"%s\",\"count\":%llu,\"unissued\":%llu,"
+                    "\"throughput\":%.1f,\"p50_us\":%.2f,\"p99_us\":%.2f,\"p999_us\":%.2f,"
+                    "\"max_us\":%.2f,\"service_p99_us\":%.2f}\n",
+                    r.rate, r.op.c_str(), static_cast<unsigned long long>(r.count),
+                    static_cast<unsigned long long>(r.unissued), r.throughput, r.p50, r.p99,
+                    r.p999, r.max, r.serviceP99);
+        return;
+    }
+    std::printf("%10.0f %-20s %10llu %10llu %12.0f %10.1f %10.1f %10.1f %10.1f %12.1f\n", r.rate,
+                r.op.c_str(), static_cast<unsigned long long>(r.count),
+                static_cast<unsigned long long>(r.unissued), r.throughput, r.p50, r.p99, r.p999,
+                r.max, r.serviceP99);
+}
+
+// Rows of an earlier --json run; lines that do not parse are skipped.
+static std::vector<Row> readBaseline(const char* path, bool& opened) {
+    std::vector<Row> rows;
+    std::ifstream in(path);
+    opened = static_cast<bool>(in);
+    std::string line;
+    infrastructure::FlatJson json;
+    auto number = [&](const char* key) { return std::strtod(std::string(json.get(key)).c_str(), nullptr); };
+    while (std::getline(in, line)) {
+        if (!json.parse(line) || !json.has("rate") || !json.has("op")) continue;
+        Row r{};
+        r.rate = number("rate");
+        r.op = std::string(json.get("op"));
+        r.count = static_cast<std::uint64_t>(number("count"));
+        r.p50 = number("p50_us");
+        r.p99 = number("p99_us");
+        r.p999 = number("p999_us");
+        rows.push_back(std::move(r));
+    }
+    return rows;
+}
+
+// Differences below this are timer and scheduler noise at any tolerance.
+static constexpr double kNoiseFloorUs = 10.0;
+
+// A percentile p is only compared when both runs have at least
+// 10 / (1 - p) samples, i.e. ten beyond it: 20 for p50, 1000 for p99.
+static std::uint64_t samplesNeeded(double percentile) {
+    return static_cast<std::uint64_t>(std::ceil(10.0 / (1.0 - percentile / 100.0) - 1e-6));
+}
+
+static int compare(const std::vector<Row>& current, const std::vector<Row>& baseline, double tolerance) {
+    int regressions = 0;
+    for (auto& base : baseline) {
+        auto it = std::find_if(current.begin(), current.end(), [&](const Row& r) {
+            return r.rate == base.rate && r.op == base.op;
+        });
+        if (it == current.end()) continue;
+        struct Check { const char* name; double percentile; double now; double before; };
+        const Check checks[] = {{"p50", 50, it->p50, base.p50},
+                                {"p99", 99, it->p99, base.p99},
+                                {"p99.9", 99.9, it->p999, base.p999}};
+        for (auto& c : checks) {
+            auto needed = samplesNeeded(c.percentile);
+            auto samples = std::min(it->count, base.count);
+            if (samples < needed) {
+                std::fprintf(stderr, "skipped rate=%.0f %s %s: %llu samples, need %llu\n",
+                             base.rate, base.op.c_str(), c.name,
+                             static_cast<unsigned long long>(samples),
+                             static_cast<unsigned long long>(needed));
+                continue;
+            }
+            if (c.now <= c.before * (1.0 + tolerance) || c.now - c.before < kNoiseFloorUs) continue;
+            std::fprintf(stderr, "REGRESSION rate=%.0f %s %s: %.1f us, baseline %.1f us\n",
+                         base.rate, base.op.c_str(), c.name, c.now, c.before);
+            ++regressions;
+        }
+    }
+    return regressions;
+}
+
+static bool parseList(const char* text, std::vector<double>& out) {
+    out.clear();
+    while (*text) {
+        char* end = nullptr;
+        double v = std::strtod(text, &end);
+        if (end == text || v < 0) return false;
+        out.push_back(v);
+        text = *end == ',' ? end + 1 : end;
+        if (*end && *end != ',') return false;
+    }
+    return !out.empty();
+}
+
+int main(int argc, char** argv) {
+    Config config;
+    bool ok = true;
+    for (int i = 1; i < argc && ok; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--json") == 0) {
+            config.json = true;
+        } else if (std::strcmp(argv[i], "--rates") == 0 && hasValue) {
+            ok = parseList(argv[++i], config.rates);
+        } else if (std::strcmp(argv[i], "--duration") == 0 && hasValue) {
+            config.duration = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--warmup") == 0 && hasValue) {
+            config.warmup = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            config.threads = std::max<std::size_t>(std::strtoul(argv[++i], nullptr, 10), 1);
+        } else if (std::strcmp(argv[i], "--mix") == 0 && hasValue) {
+            std::vector<double> mix;
+            ok = parseList(argv[++i], mix) && mix.size() == kOps;
+            if (ok) std::copy(mix.begin(), mix.end(), config.mix.begin());
+        } else if (std::strcmp(argv[i], "--customers") == 0 && hasValue) {
+            config.customers = std::max<std::size_t>(std::strtoul(argv[++i], nullptr, 10), 1);
+        } else if (std::strcmp(argv[i], "--baseline") == 0 && hasValue) {
+            config.baseline = argv[++i];
+        } else if (std::strcmp(argv[i], "--tolerance") == 0 && hasValue) {
+            config.tolerance = std::strtod(argv[++i], nullptr);
+        } else {
+            ok = false;
+        }
+    }
+    ok = ok && config.duration > config.warmup && config.warmup >= 0 &&
+         std::all_of(config.rates.begin(), config.rates.end(), [](double r) { return r > 0; });
+    if (!ok) {
+        std::fprintf(stderr,
+                     "usage: %s [--rates R1,R2,...] [--duration S] [--warmup S] [--threads T]\n"
+                     "  [--mix R,C,U,L] [--customers N] [--json] [--baseline file] [--tolerance X]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    auto logger = std::make_shared<QuietLogger>();
+    logger->setLevel(domain::LogLevel::INFO);
+    auto& notifications = domain::NotificationService::getInstance(logger);
+    notifications.addChannel(std::make_shared<QuietChannel>("Email"));
+    notifications.addChannel(std::make_shared<QuietChannel>("SMS"));
+    notifications.addChannel(std::make_shared<QuietChannel>("Push Notification"));
+    auto& customerRepo = infrastructure::InMemoryCustomerRepository::getInstance();
+    auto& ticketRepo = infrastructure::InMemoryTicketRepository::getInstance();
+    domain::CustomerService customerService(customerRepo, logger);
+    domain::TicketService ticketService(ticketRepo, customerRepo, notifications, logger);
+    for (std::size_t i = 0; i < config.customers; ++i) {
+        customerService.registerCustomer("Customer " + std::to_string(i), "customer@example.com",
+                                         "555-0100", static_cast<domain::CustomerType>(i % 3));
+    }
+    Services services{customerService, ticketService, config.customers};
+
+    if (!config.json) {
+        std::printf("%10s %-20s %10s %10s %12s %10s %10s %10s %10s %12s\n", "rate/s", "operation",
+                    "count", "unissued", "achieved/s", "p50 us", "p99 us", "p99.9 us", "max us",
+                    "svc p99 us");
+    }
+    std::vector<Row> rows;
+    for (double rate : config.rates) {
+        Step step;
+        step.rate = rate;
+        runStep(config, services, step);
+        for (auto& row : report(step)) {
+            printRow(row, config.json);
+            rows.push_back(std::move(row));
+        }
+        std::fflush(stdout);
+    }
+
+    if (!config.baseline) return 0;
+    bool opened = false;
+    auto baseline = readBaseline(config.baseline, opened);
+    if (!opened) {
+        std::fprintf(stderr, "cannot read baseline %s\n", config.baseline);
+        return 2;
+    }
+    return compare(rows, baseline, config.tolerance) ? 1 : 0;
+}
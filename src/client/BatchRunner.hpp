@@ -0,0 +1,71 @@
+#ifndef BATCH_RUNNER_HPP
+#define BATCH_RUNNER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include "CommandProcessor.hpp"
+#include "LineReader.hpp"
+
+namespace client {
+
+// Non-interactive front end: runs every line of the input through a
+// CommandProcessor and writes the replies to out in large blocks, with no
+// prompts. A summary goes to stderr.
+class BatchRunner {
+private:
+    static constexpr std::size_t kOutputBlock = 1 << 20;
+
+    CommandProcessor& processor;
+
+public:
+    struct Summary {
+        std::size_t commands = 0;
+        std::size_t failed = 0;
+        double seconds = 0;
+    };
+
+    explicit BatchRunner(CommandProcessor& p) : processor(p) {}
+
+    Summary run(LineReader& in, std::FILE* out) {
+        auto start = std::chrono::steady_clock::now();
+        Summary summary;
+        std::string buffer;
+        buffer.reserve(kOutputBlock * 2);
+
+        processor.setReplyFlush([out](std::string& pending) {
+            std::fwrite(pending.data(), 1, pending.size(), out);
+            std::fflush(out);
+            pending.clear();
+        });
+
+        std::string_view line;
+        while (in.next(line)) {
+            auto outcome = processor.execute(line, buffer);
+            if (outcome == CommandProcessor::Outcome::SKIPPED) continue;
+            ++summary.commands;
+            if (outcome == CommandProcessor::Outcome::FAILED) ++summary.failed;
+            if (buffer.size() >= kOutputBlock) {
+                std::fwrite(buffer.data(), 1, buffer.size(), out);
+                buffer.clear();
+            }
+        }
+        std::fwrite(buffer.data(), 1, buffer.size(), out);
+        std::fflush(out);
+        processor.setReplyFlush(nullptr);
+
+        summary.seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        std::fprintf(stderr, "batch: %zu commands, %zu failed, %.3f s (%.0f commands/s)\n",
+                     summary.commands, summary.failed, summary.seconds,
+                     summary.seconds > 0 ? static_cast<double>(summary.commands) / summary.seconds : 0.0);
+        return summary;
+    }
+};
+
+} // namespace client
+
+#endif
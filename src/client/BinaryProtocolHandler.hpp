@@ -0,0 +1,155 @@
+#ifndef BINARY_PROTOCOL_HANDLER_HPP
+#define BINARY_PROTOCOL_HANDLER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "../domain/interfaces/IRequestHandler.hpp"
+#include "../domain/models/Enums.hpp"
+#include "../domain/services/CustomerService.hpp"
+#include "../domain/services/TicketService.hpp"
+#include "../infrastructure/net/BinaryProtocol.hpp"
+
+namespace client {
+
+// Batched binary protocol of the server mode, see
+// infrastructure/net/BinaryProtocol.hpp. Records are decoded in place from
+// the receive buffer; a frame is checked completely before any of its
+// records is executed, so a malformed frame has no effect.
+class BinaryProtocolHandler : public domain::IRequestHandler {
+private:
+    using Opcode = infrastructure::wire::Opcode;
+    using Result = infrastructure::wire::Result;
+    using FrameReader = infrastructure::wire::FrameReader;
+    using FrameWriter = infrastructure::wire::FrameWriter;
+
+    std::shared_ptr<domain::CustomerService> customerService;
+    std::shared_ptr<domain::TicketService> ticketService;
+
+    struct Record {
+        std::string_view text[3];
+        std::uint8_t code[2] = {0, 0};
+    };
+
+    // Calls visit(record) for each of the count records; false if the
+    // records do not match the opcode exactly.
+    template <typename Visit>
+    static bool forEachRecord(Opcode opcode, std::string_view records, std::uint16_t count,
+                              Visit visit)
+    {
+        if (opcode != Opcode::CREATE_CUSTOMER && opcode != Opcode::CREATE_TICKET &&
+            opcode != Opcode::UPDATE_STATUS) {
+            return false;  // also for count == 0, which never reaches the switch
+        }
+        FrameReader reader(records);
+        Record r;
+        for (std::uint16_t i = 0; i < count; ++i) {
+            switch (opcode) {
+                case Opcode::CREATE_CUSTOMER:
+                    r.text[0] = reader.str();
+                    r.text[1] = reader.str();
+                    r.text[2] = reader.str();
+                    r.code[0] = reader.u8();
+                    break;
+                case Opcode::CREATE_TICKET:
+                    r.text[0] = reader.str();
+                    r.text[1] = reader.str();
+                    r.code[0] = reader.u8();
+                    r.code[1] = reader.u8();
+                    break;
+                case Opcode::UPDATE_STATUS:
+                    r.text[0] = reader.str();
+                    r.code[0] = reader.u8();
+                    break;
+                default:
+                    return false;
+            }
+            if (!reader.ok()) return false;
+            visit(r);
+        }
+        return reader.atEnd();
+    }
+
+    // Services take std::string; the scratch strings keep their capacity
+    // across records so short fields do not allocate.
+    static const std::string& scratch(int slot, std::string_view text) {
+        thread_local std::string strings[3];
+        return strings[slot].assign(text.data(), text.size());
+    }
+
+    void execute(Opcode opcode, const Record& r, FrameWriter& writer) {
+        std::string id;
+        Result result = Result::OK;
+        switch (opcode) {
+            case Opcode::CREATE_CUSTOMER:
+                if (r.code[0] > 2) {
+                    result = Result::INVALID;
+                    break;
+                }
+                id = customerService->registerCustomer(
+                    scratch(0, r.text[0]), scratch(1, r.text[1]), scratch(2, r.text[2]),
+                    static_cast<domain::CustomerType>(r.code[0]));
+                break;
+            case Opcode::CREATE_TICKET:
+                if (r.code[0] > 3 || r.code[1] > 4) {
+                    result = Result::INVALID;
+                    break;
+                }
+                id = ticketService->createTicket(
+                    scratch(0, r.text[0]), scratch(1, r.text[1]),
+                    static_cast<domain::Priority>(r.code[0]),
+                    static_cast<domain::TicketCategory>(r.code[1]));
+                if (id.empty()) result = Result::NOT_FOUND;
+                break;
+            default:
+                if (r.code[0] > 3) {
+                    result = Result::INVALID;
+                } else if (!ticketService->updateTicketStatus(
+                               scratch(0, r.text[0]), static_cast<domain::TicketStatus>(r.code[0]))) {
+                    result = Result::NOT_FOUND;
+                }
+                break;
+        }
+        writer.u8(static_cast<std::uint8_t>(result));
+        writer.str(id);
+    }
+
+public:
+    BinaryProtocolHandler(std::shared_ptr<domain::CustomerService> cs,
+                          std::shared_ptr<domain::TicketService> ts)
+        : customerService(cs), ticketService(ts) {}
+
+    domain::HandleResult handle(std::string_view input, std::string& out) override {
+        domain::HandleResult result;
+        infrastructure::wire::FrameHeader frame;
+        while (result.consumed < input.size()) {
+            std::size_t used = 0;
+            auto status = infrastructure::wire::decodeFrame(input.substr(result.consumed), frame, used);
+            if (status == infrastructure::wire::FrameStatus::INCOMPLETE) break;
+
+            auto noop = [](const Record&) {};
+            if (status == infrastructure::wire::FrameStatus::BAD ||
+                frame.version != infrastructure::wire::kVersion ||
+                !forEachRecord(frame.opcode, frame.records, frame.count, noop)) {
+                FrameWriter(out, Opcode::BAD_FRAME, 0).finish();
+                result.consumed = input.size();
+                result.close = true;
+                break;
+            }
+            result.consumed += used;
+
+            FrameWriter writer(out, frame.opcode, frame.count, frame.count * std::size_t{16});
+            forEachRecord(frame.opcode, frame.records, frame.count,
+                          [&](const Record& r) { execute(frame.opcode, r, writer); });
+            writer.finish();
+        }
+        return result;
+    }
+};
+
+} // namespace client
+
+#endif
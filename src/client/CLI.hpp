@@ -1,12 +1,20 @@
 #ifndef CLI_HPP
 #define CLI_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <string>
 #include <memory>
 
 #include "../domain/services/CustomerService.hpp"
 #include "../domain/services/TicketService.hpp"
+#include "../domain/services/NotificationService.hpp"
+#include "../domain/interfaces/IBulkImporter.hpp"
+#include "../domain/interfaces/ITicketExporter.hpp"
 #include "../domain/models/Enums.hpp"
 
 namespace client {
@@ -15,12 +23,20 @@ class CommandLineInterface {
 private:
     std::shared_ptr<domain::CustomerService> customerService;
     std::shared_ptr<domain::TicketService> ticketService;
+    domain::NotificationService& notificationService;
+    std::shared_ptr<domain::IBulkImporter> importer;
+    std::shared_ptr<domain::ITicketExporter> exporter;
+    std::size_t pageSize = 20;
 
 public:
     CommandLineInterface(
         std::shared_ptr<domain::CustomerService> cs,
-        std::shared_ptr<domain::TicketService> ts)
-        : customerService(cs), ticketService(ts) {}
+        std::shared_ptr<domain::TicketService> ts,
+        domain::NotificationService& ns,
+        std::shared_ptr<domain::IBulkImporter> bulkImporter = nullptr,
+        std::shared_ptr<domain::ITicketExporter> ticketExporter = nullptr)
+        : customerService(cs), ticketService(ts), notificationService(ns),
+          importer(bulkImporter), exporter(ticketExporter) {}
 
     void showMenu() {
         std::cout << "\n===== CUSTOMER & TICKET MANAGEMENT =====\n";
@@ -29,6 +45,9 @@ public:
         std::cout << "3. Create Ticket\n";
         std::cout << "4. List Tickets\n";
         std::cout << "5. Update Ticket Status\n";
+        std::cout << "6. Notification Stats\n";
+        std::cout << "7. Import CSV\n";
+        std::cout << "8. Export Tickets\n";
         std::cout << "0. Exit\n";
         std::cout << "Choose option: ";
     }
@@ -57,6 +76,15 @@ public:
                 case 5:
                     updateTicketStatusUI();
                     break;
+                case 6:
+                    notificationStatsUI();
+                    break;
+                case 7:
+                    importCsvUI();
+                    break;
+                case 8:
+                    exportTicketsUI();
+                    break;
                 case 0:
                     std::cout << "Exiting...\n";
                     break;
@@ -92,21 +120,76 @@ private:
         std::cout << "Customer registered with ID: " << id << "\n";
     }
 
-    void listCustomersUI() {
-        auto list = customerService->getAllCustomers();
-
-        std::cout << "\n--- Customers ---\n";
-        for (auto& c : list) {
-            std::cout << c->getId() << " | "
-                      << c->getName() << " | "
-                      << c->getEmail() << " | "
-                      << c->getPhone() << "\n";
+    // Browses a repository one page at a time. fetch(cursor, limit,
+    // direction) returns a page as in domain/interfaces/Paging.hpp;
+    // appendRow formats one entry. Each page is built in one buffer and
+    // written at once.
+    template <typename Fetch, typename AppendRow>
+    void browse(const char* title, const char* emptyMessage, Fetch fetch, AppendRow appendRow) {
+        auto page = fetch("", pageSize, domain::PageDirection::AFTER);
+        if (page.empty()) {
+            std::cout << emptyMessage << "\n";
+            return;
         }
-        if (list.empty()) {
-            std::cout << "No customers found.\n";
+
+        std::string buffer;
+        std::string command;
+        for (;;) {
+            buffer.clear();
+            buffer += "\n--- ";
+            buffer += title;
+            buffer += " ---\n";
+            for (auto& item : page) appendRow(buffer, *item);
+            buffer += "[n]ext  [p]rev  [j <cursor>] jump  [s <size>] page size  [q]uit"
+                      "  (cursor: ";
+            buffer += page.back()->getId();
+            buffer += ")\n> ";
+            std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            std::cout.flush();
+
+            if (!std::getline(std::cin, command) || command.empty() || command == "q") return;
+
+            decltype(page) next;
+            if (command == "n") {
+                next = fetch(page.back()->getId(), pageSize, domain::PageDirection::AFTER);
+                if (next.empty()) std::cout << "End of list.\n";
+            } else if (command == "p") {
+                next = fetch(page.front()->getId(), pageSize, domain::PageDirection::BEFORE);
+                if (next.empty()) std::cout << "Start of list.\n";
+            } else if (command.rfind("j ", 0) == 0) {
+                next = fetch(command.substr(2), pageSize, domain::PageDirection::AFTER);
+                if (next.empty()) std::cout << "Nothing after " << command.substr(2) << ".\n";
+            } else if (command.rfind("s ", 0) == 0) {
+                long size = std::strtol(command.c_str() + 2, nullptr, 10);
+                if (size <= 0) {
+                    std::cout << "Invalid page size.\n";
+                    continue;
+                }
+                pageSize = static_cast<std::size_t>(size);
+                // Reload from the current first row
+                auto before = fetch(page.front()->getId(), 1, domain::PageDirection::BEFORE);
+                next = fetch(before.empty() ? std::string() : before.front()->getId(),
+                             pageSize, domain::PageDirection::AFTER);
+            } else {
+                std::cout << "Unknown command.\n";
+            }
+            if (!next.empty()) page = std::move(next);
         }
     }
 
+    void listCustomersUI() {
+        browse("Customers", "No customers found.",
+            [this](const std::string& cursor, std::size_t limit, domain::PageDirection direction) {
+                return customerService->getCustomersPage(cursor, limit, direction);
+            },
+            [](std::string& out, const domain::Customer& c) {
+                out += c.getId(); out += " | ";
+                out += c.getName(); out += " | ";
+                out += c.getEmail(); out += " | ";
+                out += c.getPhone(); out += '\n';
+            });
+    }
+
     void createTicketUI() {
         std::string customerId, description;
         int priority, category;
@@ -139,20 +222,18 @@ private:
     }
 
     void listTicketsUI() {
-        auto list = ticketService->getAllTickets();
-
-        std::cout << "\n--- Tickets ---\n";
-        for (auto& t : list) {
-            std::cout << t->getId() << " | "
-                      << t->getCustomerId() << " | "
-                      << t->getDescription() << " | "
-                      << domain::TicketFactory::getCategoryName(t->getCategory()) << " | "
-                      << domain::TicketFactory::getPriorityName(t->getPriority()) << " | "
-                      << domain::TicketFactory::getStatusName(t->getStatus()) << "\n";
-        }
-        if (list.empty()) {
-            std::cout << "No tickets found.\n";
-        }
+        browse("Tickets", "No tickets found.",
+            [this](const std::string& cursor, std::size_t limit, domain::PageDirection direction) {
+                return ticketService->getTicketsPage(cursor, limit, direction);
+            },
+            [](std::string& out, const domain::Ticket& t) {
+                out += t.getId(); out += " | ";
+                out += t.getCustomerId(); out += " | ";
+                out += t.getDescription(); out += " | ";
+                out += domain::TicketFactory::getCategoryName(t.getCategory()); out += " | ";
+                out += domain::TicketFactory::getPriorityName(t.getPriority()); out += " | ";
+                out += domain::TicketFactory::getStatusName(t.getStatus()); out += '\n';
+            });
     }
 
     void updateTicketStatusUI() {
@@ -174,6 +255,136 @@ private:
         if (ok) std::cout << "Status updated.\n";
         else std::cout << "Failed to update.\n";
     }
+
+    void importCsvUI() {
+        if (!importer) {
+            std::cout << "Import is not available.\n";
+            return;
+        }
+
+        int kind;
+        std::string path;
+
+        std::cout << "Import (0=CUSTOMERS, 1=TICKETS): ";
+        std::cin >> kind;
+        std::cin.ignore();
+
+        std::cout << "CSV file path: ";
+        std::getline(std::cin, path);
+
+        domain::ImportReport report;
+        if (kind == 0) {
+            report = importer->importCustomers(path);
+            customerService->reserveIds(report.highestIdNumber);
+        } else {
+            report = importer->importTickets(path);
+            ticketService->reserveIds(report.highestIdNumber);
+        }
+
+        if (!report.opened) {
+            std::cout << "Cannot open " << path << "\n";
+            return;
+        }
+        for (auto& e : report.errors) {
+            std::cout << "  line " << e.line << ": " << e.message << "\n";
+        }
+        if (report.failed > report.errors.size()) {
+            std::cout << "  ... " << report.failed - report.errors.size() << " more errors\n";
+        }
+        std::cout << "Imported " << report.imported << " of " << report.rows << " rows ("
+                  << report.failed << " failed) in " << report.seconds << " s, "
+                  << static_cast<std::uint64_t>(report.rowsPerSecond()) << " rows/s\n";
+    }
+
+    void exportTicketsUI() {
+        if (!exporter) {
+            std::cout << "Export is not available.\n";
+            return;
+        }
+
+        int format = 0, status = -1, priority = -1, category = -1;
+        std::string compress, path, customerId;
+        domain::ExportOptions options;
+
+        std::cout << "Format (0=CSV, 1=JSON_LINES, 2=BINARY): ";
+        if (!(std::cin >> format) || format < 0 || format > 2) {
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            std::cout << "Invalid format.\n";
+            return;
+        }
+        std::cin.ignore();
+        options.format = static_cast<domain::ExportFormat>(format);
+
+        std::cout << "Compress with gzip (y/n): ";
+        std::getline(std::cin, compress);
+        options.compress = compress == "y" || compress == "Y";
+
+        std::cout << "Output file path: ";
+        std::getline(std::cin, path);
+
+        std::cout << "Status filter (-1=ANY, 0=OPEN,1=IN_PROGRESS,2=RESOLVED,3=CLOSED): ";
+        std::cin >> status;
+        std::cout << "Priority filter (-1=ANY, 0=LOW, 1=MEDIUM, 2=HIGH, 3=CRITICAL): ";
+        std::cin >> priority;
+        std::cout << "Category filter (-1=ANY, 0=TECH, 1=BILL, 2=GEN, 3=COMP, 4=FEAT): ";
+        std::cin >> category;
+        if (!std::cin || status < -1 || status > 3 || priority < -1 || priority > 3 ||
+            category < -1 || category > 4) {
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            std::cout << "Invalid filter.\n";
+            return;
+        }
+        std::cin.ignore();
+        std::cout << "Customer ID filter (empty=ANY): ";
+        std::getline(std::cin, customerId);
+
+        if (status >= 0) options.filter.status = static_cast<domain::TicketStatus>(status);
+        if (priority >= 0) options.filter.priority = static_cast<domain::Priority>(priority);
+        if (category >= 0) options.filter.category = static_cast<domain::TicketCategory>(category);
+        options.filter.customerId = customerId;
+
+        auto report = exporter->exportTickets(path, options);
+        if (!report.opened) {
+            std::cout << "Cannot open " << path << "\n";
+            return;
+        }
+        if (report.writeFailed) {
+            std::cout << "Write to " << path << " failed.\n";
+            return;
+        }
+        std::cout << "Exported " << report.rows << " of " << report.scanned << " tickets, "
+                  << report.bytes << " bytes in " << report.seconds << " s\n";
+    }
+
+    static std::string formatMicros(std::uint64_t ns) {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%.1f", static_cast<double>(ns) / 1000.0);
+        return buf;
+    }
+
+    void notificationStatsUI() {
+        auto stats = notificationService.getStats();
+
+        std::cout << "\n--- Notification Stats (latency in us) ---\n";
+        for (auto& s : stats) {
+            std::cout << s.channel << " | sent " << s.sent
+                      << " | failed " << s.failed
+                      << " | retried " << s.retried
+                      << " | dropped " << s.dropped << "\n";
+            std::cout << "  queue p50 " << formatMicros(s.queueLatency.percentile(50))
+                      << " p99 " << formatMicros(s.queueLatency.percentile(99))
+                      << " max " << formatMicros(s.queueLatency.max) << "\n";
+            std::cout << "  send  p50 " << formatMicros(s.sendLatency.percentile(50))
+                      << " p99 " << formatMicros(s.sendLatency.percentile(99))
+                      << " p99.9 " << formatMicros(s.sendLatency.percentile(99.9))
+                      << " max " << formatMicros(s.sendLatency.max) << "\n";
+        }
+        if (stats.empty()) {
+            std::cout << "No notification channels registered.\n";
+        }
+    }
 };
 
 } // namespace client
@@ -0,0 +1,374 @@
+#ifndef COMMAND_PROCESSOR_HPP
+#define COMMAND_PROCESSOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "../domain/services/CustomerService.hpp"
+#include "../domain/services/TicketService.hpp"
+#include "../domain/services/NotificationService.hpp"
+#include "../domain/factory/CustomerFactory.hpp"
+#include "../domain/interfaces/IBulkImporter.hpp"
+#include "../domain/interfaces/ITicketExporter.hpp"
+#include "../domain/factory/TicketFactory.hpp"
+#include "../domain/models/Enums.hpp"
+
+namespace client {
+
+// Executes one-line, '|'-separated commands and appends a compact reply:
+//   customer|<name>|<email>|<phone>|<type 0-2>          -> OK CUST-1001
+//   ticket|<customer id>|<description>|<priority 0-3>|<category 0-4>
+//                                                       -> OK TKT-1001
+//   status|<ticket id>|<status 0-3>                     -> OK
+//   customers[|<cursor>|<limit>]
+//                            -> one "id|name|email|phone" row each, then OK <n>
+//   tickets[|<cursor>|<limit>]
+//                            -> one "id|customer|description|category|priority|status"
+//                               row each, then OK <n>
+//                               With a limit, only the next <limit> entries after
+//                               <cursor> (an id, empty for the start) are listed.
+//   stats                    -> one "channel|sent|failed|retried|dropped" row each, then OK <n>
+//   memory                   -> one "store|entries|index|entities|strings|tags|total" row
+//                               (bytes) for customers and tickets, then OK 2
+//   import|customers|<csv path>
+//   import|tickets|<csv path>
+//                            -> one "E|line|reason" row per rejected row (first 100),
+//                               then OK <imported> <failed> <rows/s>
+//   export|<csv|jsonl|bin>[.gz]|<path or ->[|<filter>]
+//                            -> OK <rows> <bytes>; filter is a comma-separated
+//                               list of status=<0-3>, priority=<0-3>,
+//                               category=<0-4>, customer=<id>
+// Failures reply "ERR <reason>". Blank lines and lines starting with '#'
+// produce no reply.
+class CommandProcessor {
+private:
+    static constexpr std::size_t kMaxFields = 6;
+
+    std::shared_ptr<domain::CustomerService> customerService;
+    std::shared_ptr<domain::TicketService> ticketService;
+    domain::NotificationService& notificationService;
+    std::shared_ptr<domain::IBulkImporter> importer;
+    std::shared_ptr<domain::ITicketExporter> exporter;
+    std::function<void(std::string&)> flushReplies;
+
+    struct Fields {
+        std::array<std::string_view, kMaxFields> values;
+        std::size_t count = 0;
+    };
+
+    static Fields split(std::string_view line) {
+        Fields fields;
+        while (fields.count < kMaxFields) {
+            auto bar = line.find('|');
+            fields.values[fields.count++] = line.substr(0, bar);
+            if (bar == std::string_view::npos) return fields;
+            line.remove_prefix(bar + 1);
+        }
+        fields.count = kMaxFields + 1;  // too many
+        return fields;
+    }
+
+    static bool parseEnum(std::string_view text, int max, int& value) {
+        auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+        return result.ec == std::errc() && result.ptr == text.data() + text.size() &&
+               value >= 0 && value <= max;
+    }
+
+    static void appendNumber(std::string& out, std::uint64_t value) {
+        char buf[24];
+        auto result = std::to_chars(buf, buf + sizeof(buf), value);
+        out.append(buf, result.ptr);
+    }
+
+    static void reply(std::string& out, std::string_view status, std::string_view detail = {}) {
+        out.append(status);
+        if (!detail.empty()) {
+            out.push_back(' ');
+            out.append(detail);
+        }
+        out.push_back('\n');
+    }
+
+    static bool fail(std::string& out, std::string_view reason) {
+        reply(out, "ERR", reason);
+        return false;
+    }
+
+    bool registerCustomer(const Fields& f, std::string& out) {
+        int type;
+        if (f.count != 5) return fail(out, "usage: customer|name|email|phone|type");
+        if (!parseEnum(f.values[4], 2, type)) return fail(out, "invalid customer type");
+        auto id = customerService->registerCustomer(
+            std::string(f.values[1]), std::string(f.values[2]), std::string(f.values[3]),
+            static_cast<domain::CustomerType>(type));
+        reply(out, "OK", id);
+        return true;
+    }
+
+    bool createTicket(const Fields& f, std::string& out) {
+        int priority, category;
+        if (f.count != 5) return fail(out, "usage: ticket|customer|description|priority|category");
+        if (!parseEnum(f.values[3], 3, priority)) return fail(out, "invalid priority");
+        if (!parseEnum(f.values[4], 4, category)) return fail(out, "invalid category");
+        auto id = ticketService->createTicket(
+            std::string(f.values[1]), std::string(f.values[2]),
+            static_cast<domain::Priority>(priority),
+            static_cast<domain::TicketCategory>(category));
+        if (id.empty()) return fail(out, "customer not found");
+        reply(out, "OK", id);
+        return true;
+    }
+
+    bool updateStatus(const Fields& f, std::string& out) {
+        int status;
+        if (f.count != 3) return fail(out, "usage: status|ticket|status");
+        if (!parseEnum(f.values[2], 3, status)) return fail(out, "invalid status");
+        if (!ticketService->updateTicketStatus(std::string(f.values[1]),
+                                               static_cast<domain::TicketStatus>(status))) {
+            return fail(out, "ticket not found");
+        }
+        reply(out, "OK");
+        return true;
+    }
+
+    bool importCsv(const Fields& f, std::string& out) {
+        if (f.count != 3) return fail(out, "usage: import|customers|path or import|tickets|path");
+        if (!importer) return fail(out, "import not available");
+
+        domain::ImportReport report;
+        if (f.values[1] == "customers") {
+            report = importer->importCustomers(std::string(f.values[2]));
+            customerService->reserveIds(report.highestIdNumber);
+        } else if (f.values[1] == "tickets") {
+            report = importer->importTickets(std::string(f.values[2]));
+            ticketService->reserveIds(report.highestIdNumber);
+        } else {
+            return fail(out, "import target must be customers or tickets");
+        }
+        if (!report.opened) return fail(out, "cannot open file");
+
+        for (auto& e : report.errors) {
+            out += "E|";
+            appendNumber(out, e.line);
+            out += '|';
+            out += e.message;
+            out += '\n';
+        }
+        out += "OK ";
+        appendNumber(out, report.imported);
+        out += ' ';
+        appendNumber(out, report.failed);
+        out += ' ';
+        appendNumber(out, static_cast<std::uint64_t>(report.rowsPerSecond()));
+        out += '\n';
+        return report.failed == 0;
+    }
+
+    static bool parseFormat(std::string_view text, domain::ExportOptions& options) {
+        constexpr std::string_view kGzip = ".gz";
+        options.compress = text.size() > kGzip.size() &&
+                           text.substr(text.size() - kGzip.size()) == kGzip;
+        if (options.compress) text.remove_suffix(kGzip.size());
+        if (text == "csv") options.format = domain::ExportFormat::CSV;
+        else if (text == "jsonl") options.format = domain::ExportFormat::JSON_LINES;
+        else if (text == "bin") options.format = domain::ExportFormat::BINARY;
+        else return false;
+        return true;
+    }
+
+    static bool parseFilter(std::string_view text, domain::TicketFilter& filter) {
+        while (!text.empty()) {
+            auto comma = text.find(',');
+            std::string_view term = text.substr(0, comma);
+            text.remove_prefix(comma == std::string_view::npos ? text.size() : comma + 1);
+
+            auto eq = term.find('=');
+            if (eq == std::string_view::npos) return false;
+            std::string_view key = term.substr(0, eq);
+            std::string_view value = term.substr(eq + 1);
+            int code;
+            if (key == "status" && parseEnum(value, 3, code)) {
+                filter.status = static_cast<domain::TicketStatus>(code);
+            } else if (key == "priority" && parseEnum(value, 3, code)) {
+                filter.priority = static_cast<domain::Priority>(code);
+            } else if (key == "category" && parseEnum(value, 4, code)) {
+                filter.category = static_cast<domain::TicketCategory>(code);
+            } else if (key == "customer" && !value.empty()) {
+                filter.customerId = std::string(value);
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool exportTickets(const Fields& f, std::string& out) {
+        if (f.count != 3 && f.count != 4) {
+            return fail(out, "usage: export|csv|jsonl|bin[.gz]|path[|filter]");
+        }
+        if (!exporter) return fail(out, "export not available");
+
+        domain::ExportOptions options;
+        if (!parseFormat(f.values[1], options)) return fail(out, "invalid export format");
+        if (f.count == 4 && !parseFilter(f.values[3], options.filter)) {
+            return fail(out, "invalid filter");
+        }
+
+        // An export to stdout must follow the replies written so far
+        if (f.values[2] == "-" && flushReplies) flushReplies(out);
+        auto report = exporter->exportTickets(std::string(f.values[2]), options);
+        if (!report.opened) return fail(out, "cannot open file");
+        if (report.writeFailed) return fail(out, "write failed");
+
+        out += "OK ";
+        appendNumber(out, report.rows);
+        out += ' ';
+        appendNumber(out, report.bytes);
+        out += '\n';
+        return true;
+    }
+
+    // Walks fetch(cursor, limit) page by page, so a full listing never
+    // holds more than one page of the store.
+    template <typename Fetch, typename AppendRow>
+    bool listPaged(const Fields& f, std::string& out, Fetch fetch, AppendRow appendRow) {
+        static constexpr std::size_t kPageSize = 1024;
+
+        std::string cursor;
+        std::size_t limit = SIZE_MAX;
+        if (f.count == 3) {
+            cursor = std::string(f.values[1]);
+            auto text = f.values[2];
+            auto result = std::from_chars(text.data(), text.data() + text.size(), limit);
+            if (result.ec != std::errc() || result.ptr != text.data() + text.size() || limit == 0) {
+                return fail(out, "invalid limit");
+            }
+        } else if (f.count != 1) {
+            return fail(out, "usage: customers|tickets[|cursor|limit]");
+        }
+
+        std::size_t count = 0;
+        while (count < limit) {
+            std::size_t want = std::min(kPageSize, limit - count);
+            auto page = fetch(cursor, want);
+            for (auto& item : page) appendRow(out, *item);
+            count += page.size();
+            if (page.size() < want) break;
+            cursor = page.back()->getId();
+        }
+        out += "OK ";
+        appendNumber(out, count);
+        out += '\n';
+        return true;
+    }
+
+    bool listCustomers(const Fields& f, std::string& out) {
+        return listPaged(f, out,
+            [this](const std::string& cursor, std::size_t limit) {
+                return customerService->getCustomersPage(cursor, limit);
+            },
+            [](std::string& o, const domain::Customer& c) {
+                o += c.getId(); o += '|';
+                o += c.getName(); o += '|';
+                o += c.getEmail(); o += '|';
+                o += c.getPhone(); o += '\n';
+            });
+    }
+
+    bool listTickets(const Fields& f, std::string& out) {
+        return listPaged(f, out,
+            [this](const std::string& cursor, std::size_t limit) {
+                return ticketService->getTicketsPage(cursor, limit);
+            },
+            [](std::string& o, const domain::Ticket& t) {
+                o += t.getId(); o += '|';
+                o += t.getCustomerId(); o += '|';
+                o += t.getDescription(); o += '|';
+                o += domain::TicketFactory::getCategoryName(t.getCategory()); o += '|';
+                o += domain::TicketFactory::getPriorityName(t.getPriority()); o += '|';
+                o += domain::TicketFactory::getStatusName(t.getStatus()); o += '\n';
+            });
+    }
+
+    void listStats(std::string& out) {
+        auto stats = notificationService.getStats();
+        for (auto& s : stats) {
+            out += s.channel; out += '|';
+            appendNumber(out, s.sent); out += '|';
+            appendNumber(out, s.failed); out += '|';
+            appendNumber(out, s.retried); out += '|';
+            appendNumber(out, s.dropped); out += '\n';
+        }
+        out += "OK ";
+        appendNumber(out, stats.size());
+        out += '\n';
+    }
+
+    static void appendUsage(std::string& out, std::string_view store, const domain::MemoryUsage& u) {
+        out.append(store); out += '|';
+        appendNumber(out, u.entries); out += '|';
+        appendNumber(out, u.indexBytes); out += '|';
+        appendNumber(out, u.entityBytes); out += '|';
+        appendNumber(out, u.stringBytes); out += '|';
+        appendNumber(out, u.tagBytes); out += '|';
+        appendNumber(out, u.total()); out += '\n';
+    }
+
+    void listMemory(std::string& out) {
+        appendUsage(out, "customers", customerService->memoryUsage());
+        appendUsage(out, "tickets", ticketService->memoryUsage());
+        out += "OK 2\n";
+    }
+
+public:
+    CommandProcessor(std::shared_ptr<domain::CustomerService> cs,
+                     std::shared_ptr<domain::TicketService> ts,
+                     domain::NotificationService& ns,
+                     std::shared_ptr<domain::IBulkImporter> bulkImporter = nullptr,
+                     std::shared_ptr<domain::ITicketExporter> ticketExporter = nullptr)
+        : customerService(cs), ticketService(ts), notificationService(ns),
+          importer(bulkImporter), exporter(ticketExporter) {}
+
+    // Called with the reply buffer before an export to stdout; it must
+    // write out and clear the buffered replies.
+    void setReplyFlush(std::function<void(std::string&)> flush) {
+        flushReplies = std::move(flush);
+    }
+
+    enum class Outcome { SKIPPED, OK, FAILED };
+
+    Outcome execute(std::string_view line, std::string& out) {
+        if (line.empty() || line.front() == '#') return Outcome::SKIPPED;
+
+        Fields f = split(line);
+        if (f.count > kMaxFields) {
+            reply(out, "ERR", "too many fields");
+            return Outcome::FAILED;
+        }
+
+        std::string_view command = f.values[0];
+        bool ok = true;
+        if (command == "customer") ok = registerCustomer(f, out);
+        else if (command == "ticket") ok = createTicket(f, out);
+        else if (command == "status") ok = updateStatus(f, out);
+        else if (command == "customers") ok = listCustomers(f, out);
+        else if (command == "tickets") ok = listTickets(f, out);
+        else if (command == "stats") listStats(out);
+        else if (command == "memory") listMemory(out);
+        else if (command == "import") ok = importCsv(f, out);
+        else if (command == "export") ok = exportTickets(f, out);
+        else ok = fail(out, "unknown command");
+        return ok ? Outcome::OK : Outcome::FAILED;
+    }
+};
+
+} // namespace client
+
+#endif
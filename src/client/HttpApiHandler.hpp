@@ -0,0 +1,293 @@
+#ifndef HTTP_API_HANDLER_HPP
+#define HTTP_API_HANDLER_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "../domain/interfaces/IRequestHandler.hpp"
+#include "../domain/logging/LogField.hpp"
+#include "../domain/models/EnumNames.hpp"
+#include "../domain/services/CustomerService.hpp"
+#include "../domain/services/NotificationService.hpp"
+#include "../domain/services/TicketService.hpp"
+#include "../infrastructure/net/FlatJson.hpp"
+#include "../infrastructure/metrics/PrometheusFormat.hpp"
+#include "../infrastructure/net/HttpMessage.hpp"
+#include "../infrastructure/trace/ChromeTraceWriter.hpp"
+
+namespace client {
+
+// JSON API over HTTP/1.1 for `app --serve ... --protocol http`:
+//   POST /customers              {"name","email","phone","type"}  -> 201 {"id"}
+//   GET  /customers/<id>
+//   GET  /customers?cursor=<id>&limit=<n>                         -> {"items","next"}
+//   POST /tickets                {"customer_id","description","priority","category"}
+//   GET  /tickets/<id>
+//   GET  /tickets?cursor=<id>&limit=<n>
+//   PUT  /tickets/<id>/status    {"status"}
+//   GET  /stats
+//   GET  /metrics                 -> Prometheus text format
+//   GET  /trace                   -> sampled spans as Chrome trace-event JSON
+// Enum values are the names of domain/models/EnumNames.hpp or their codes.
+// Requests are parsed in place and every pipelined request in the input
+// is answered in order; errors reply {"error": "..."}.
+class HttpApiHandler : public domain::IRequestHandler {
+private:
+    static constexpr std::size_t kDefaultLimit = 100;
+    static constexpr std::size_t kMaxLimit = 1000;
+
+    std::shared_ptr<domain::CustomerService> customerService;
+    std::shared_ptr<domain::TicketService> ticketService;
+    domain::NotificationService& notificationService;
+
+    static void appendString(std::string& out, std::string_view text) {
+        out.push_back('"');
+        domain::appendJsonEscaped(out, text);
+        out.push_back('"');
+    }
+
+    static void appendNumber(std::string& out, std::int64_t value) {
+        char buf[24];
+        auto end = std::to_chars(buf, buf + sizeof(buf), value).ptr;
+        out.append(buf, end);
+    }
+
+    static int error(std::string& body, int status, std::string_view message) {
+        body += "{\"error\":";
+        appendString(body, message);
+        body += '}';
+        return status;
+    }
+
+    static void appendCustomer(std::string& out, const domain::Customer& c) {
+        out += "{\"id\":"; appendString(out, c.getId());
+        out += ",\"name\":"; appendString(out, c.getName());
+        out += ",\"email\":"; appendString(out, c.getEmail());
+        out += ",\"phone\":"; appendString(out, c.getPhone());
+        out += ",\"type\":"; appendString(out, domain::enumnames::name(c.getType()));
+        out += '}';
+    }
+
+    static void appendTicket(std::string& out, const domain::Ticket& t) {
+        out += "{\"id\":"; appendString(out, t.getId());
+        out += ",\"customer_id\":"; appendString(out, t.getCustomerId());
+        out += ",\"description\":"; appendString(out, t.getDescription());
+        out += ",\"priority\":"; appendString(out, domain::enumnames::name(t.getPriority()));
+        out += ",\"category\":"; appendString(out, domain::enumnames::name(t.getCategory()));
+        out += ",\"status\":"; appendString(out, domain::enumnames::name(t.getStatus()));
+        out += ",\"assigned_to\":"; appendString(out, t.getAssignedTo());
+        out += ",\"created_at\":"; appendNumber(out, static_cast<std::int64_t>(t.getCreatedAt()));
+        out += ",\"tags\":[";
+        const auto& tags = t.getTags();
+        for (std::size_t i = 0; i < tags.size(); ++i) {
+            if (i) out += ',';
+            appendString(out, tags[i]);
+        }
+        out += "]}";
+    }
+
+    // GET /<collection>?cursor=&limit=
+    template <typename Fetch, typename Append>
+    static int listPage(const infrastructure::HttpRequest& req, std::string& body,
+                        Fetch fetch, Append append)
+    {
+        std::size_t limit = kDefaultLimit;
+        auto limitText = req.queryParam("limit");
+        if (!limitText.empty()) {
+            auto r = std::from_chars(limitText.data(), limitText.data() + limitText.size(), limit);
+            if (r.ec != std::errc() || r.ptr != limitText.data() + limitText.size() || limit == 0) {
+                return error(body, 400, "invalid limit");
+            }
+            limit = std::min(limit, kMaxLimit);
+        }
+        auto page = fetch(std::string(req.queryParam("cursor")), limit);
+        body += "{\"items\":[";
+        for (std::size_t i = 0; i < page.size(); ++i) {
+            if (i) body += ',';
+            append(body, *page[i]);
+        }
+        body += "],\"next\":";
+        if (page.size() == limit) appendString(body, page.back()->getId());
+        else body += "null";
+        body += '}';
+        return 200;
+    }
+
+    int createCustomer(const infrastructure::FlatJson& json, std::string& body) {
+        domain::CustomerType type = domain::CustomerType::REGULAR;
+        if (json.get("name").empty()) return error(body, 422, "name is required");
+        if (json.has("type") && !domain::enumnames::parse(json.get("type"), type)) {
+            return error(body, 422, "invalid type");
+        }
+        auto id = customerService->registerCustomer(std::string(json.get("name")),
+                                                    std::string(json.get("email")),
+                                                    std::string(json.get("phone")), type);
+        body += "{\"id\":";
+        appendString(body, id);
+        body += '}';
+        return 201;
+    }
+
+    int createTicket(const infrastructure::FlatJson& json, std::string& body) {
+        domain::Priority priority;
+        domain::TicketCategory category = domain::TicketCategory::GENERAL;
+        if (!domain::enumnames::parse(json.get("priority"), priority)) {
+            return error(body, 422, "invalid priority");
+        }
+        if (json.has("category") && !domain::enumnames::parse(json.get("category"), category)) {
+            return error(body, 422, "invalid category");
+        }
+        auto id = ticketService->createTicket(std::string(json.get("customer_id")),
+                                              std::string(json.get("description")),
+                                              priority, category);
+        if (id.empty()) return error(body, 422, "customer not found");
+        body += "{\"id\":";
+        appendString(body, id);
+        body += '}';
+        return 201;
+    }
+
+    int updateStatus(const std::string& ticketId, const infrastructure::FlatJson& json,
+                     std::string& body)
+    {
+        domain::TicketStatus status;
+        if (!domain::enumnames::parse(json.get("status"), status)) {
+            return error(body, 422, "invalid status");
+        }
+        if (!ticketService->updateTicketStatus(ticketId, status)) {
+            return error(body, 404, "ticket not found");
+        }
+        body += "{\"id\":";
+        appendString(body, ticketId);
+        body += ",\"status\":";
+        appendString(body, domain::enumnames::name(status));
+        body += '}';
+        return 200;
+    }
+
+    int stats(std::string& body) {
+        body += "{\"channels\":[";
+        auto list = notificationService.getStats();
+        for (std::size_t i = 0; i < list.size(); ++i) {
+            auto& s = list[i];
+            if (i) body += ',';
+            body += "{\"channel\":"; appendString(body, s.channel);
+            body += ",\"sent\":"; appendNumber(body, static_cast<std::int64_t>(s.sent));
+            body += ",\"failed\":"; appendNumber(body, static_cast<std::int64_t>(s.failed));
+            body += ",\"retried\":"; appendNumber(body, static_cast<std::int64_t>(s.retried));
+            body += ",\"dropped\":"; appendNumber(body, static_cast<std::int64_t>(s.dropped));
+            body += '}';
+        }
+        body += "]}";
+        return 200;
+    }
+
+    int route(const infrastructure::HttpRequest& req, std::string& body) {
+        thread_local infrastructure::FlatJson json;
+        bool get = req.method == "GET";
+        bool hasBody = req.method == "POST" || req.method == "PUT";
+        if (hasBody && !json.parse(req.body)) return error(body, 400, "body must be a JSON object");
+
+        std::string_view path = req.path;
+        if (path == "/customers") {
+            if (get) {
+                return listPage(req, body,
+                    [this](const std::string& cursor, std::size_t limit) {
+                        return customerService->getCustomersPage(cursor, limit);
+                    }, appendCustomer);
+            }
+            if (req.method == "POST") return createCustomer(json, body);
+            return error(body, 405, "use GET or POST");
+        }
+        if (path == "/tickets") {
+            if (get) {
+                return listPage(req, body,
+                    [this](const std::string& cursor, std::size_t limit) {
+                        return ticketService->getTicketsPage(cursor, limit);
+                    }, appendTicket);
+            }
+            if (req.method == "POST") return createTicket(json, body);
+            return error(body, 405, "use GET or POST");
+        }
+        if (path == "/stats") {
+            return get ? stats(body) : error(body, 405, "use GET");
+        }
+
+        constexpr std::string_view kCustomerPrefix = "/customers/";
+        constexpr std::string_view kTicketPrefix = "/tickets/";
+        constexpr std::string_view kStatusSuffix = "/status";
+        if (path.substr(0, kCustomerPrefix.size()) == kCustomerPrefix) {
+            if (!get) return error(body, 405, "use GET");
+            auto customer = customerService->getCustomer(std::string(path.substr(kCustomerPrefix.size())));
+            if (!customer) return error(body, 404, "customer not found");
+            appendCustomer(body, *customer);
+            return 200;
+        }
+        if (path.substr(0, kTicketPrefix.size()) == kTicketPrefix) {
+            std::string_view rest = path.substr(kTicketPrefix.size());
+            if (rest.size() > kStatusSuffix.size() &&
+                rest.substr(rest.size() - kStatusSuffix.size()) == kStatusSuffix) {
+                if (req.method != "PUT") return error(body, 405, "use PUT");
+                rest.remove_suffix(kStatusSuffix.size());
+                return updateStatus(std::string(rest), json, body);
+            }
+            if (!get) return error(body, 405, "use GET");
+            auto ticket = ticketService->getTicket(std::string(rest));
+            if (!ticket) return error(body, 404, "ticket not found");
+            appendTicket(body, *ticket);
+            return 200;
+        }
+        return error(body, 404, "no such resource");
+    }
+
+public:
+    HttpApiHandler(std::shared_ptr<domain::CustomerService> cs,
+                   std::shared_ptr<domain::TicketService> ts,
+                   domain::NotificationService& ns)
+        : customerService(cs), ticketService(ts), notificationService(ns) {}
+
+    domain::HandleResult handle(std::string_view input, std::string& out) override {
+        thread_local std::string body;
+        domain::HandleResult result;
+        infrastructure::HttpRequest req;
+        while (result.consumed < input.size()) {
+            std::size_t used = 0;
+            auto status = infrastructure::http::parseRequest(input.substr(result.consumed), req, used);
+            if (status == infrastructure::http::ParseStatus::INCOMPLETE) break;
+            body.clear();
+            if (status == infrastructure::http::ParseStatus::BAD) {
+                error(body, 400, "malformed request");
+                infrastructure::http::appendResponse(out, 400, body, false);
+                result.consumed = input.size();
+                result.close = true;
+                break;
+            }
+            result.consumed += used;
+            if (req.path == "/metrics" && req.method == "GET") {
+                infrastructure::prometheus::append(body, domain::MetricsRegistry::getInstance().collect());
+                infrastructure::http::appendResponse(out, 200, body, req.keepAlive,
+                                                     infrastructure::prometheus::kContentType);
+            } else if (req.path == "/trace" && req.method == "GET") {
+                infrastructure::chrome::appendTrace(body, domain::Tracer::getInstance().collect());
+                infrastructure::http::appendResponse(out, 200, body, req.keepAlive);
+            } else {
+                int code = route(req, body);
+                infrastructure::http::appendResponse(out, code, body, req.keepAlive);
+            }
+            if (!req.keepAlive) {
+                result.close = true;
+                break;
+            }
+        }
+        return result;
+    }
+};
+
+} // namespace client
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef LINE_PROTOCOL_HANDLER_HPP
+#define LINE_PROTOCOL_HANDLER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "CommandProcessor.hpp"
+#include "../domain/interfaces/IRequestHandler.hpp"
+
+namespace client {
+
+// Text protocol of the server mode: the batch commands of CommandProcessor,
+// one per '\n'-terminated line, each answered with its reply. "quit" closes
+// the connection.
+class LineProtocolHandler : public domain::IRequestHandler {
+private:
+    static constexpr std::size_t kMaxLine = 64 * 1024;
+
+    CommandProcessor& processor;
+
+public:
+    explicit LineProtocolHandler(CommandProcessor& commands) : processor(commands) {}
+
+    domain::HandleResult handle(std::string_view input, std::string& out) override {
+        domain::HandleResult result;
+        for (;;) {
+            auto newline = input.find('\n', result.consumed);
+            if (newline == std::string_view::npos) {
+                if (input.size() - result.consumed > kMaxLine) {
+                    out += "ERR line too long\n";
+                    result.close = true;
+                }
+                return result;
+            }
+            std::string_view line = input.substr(result.consumed, newline - result.consumed);
+            result.consumed = newline + 1;
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            if (line == "quit") {
+                result.close = true;
+                return result;
+            }
+            processor.execute(line, out);
+        }
+    }
+};
+
+} // namespace client
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef LINE_READER_HPP
+#define LINE_READER_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace client {
+
+// Reads newline-delimited input from a file descriptor in large blocks and
+// hands out each line as a view into its buffer (valid until the next
+// call). Handles "\r\n" and a missing final newline.
+class LineReader {
+private:
+    static constexpr std::size_t kBlockSize = 1 << 20;
+
+    int fd;
+    bool ownsFd;
+    std::unique_ptr<char[]> buffer;
+    std::size_t capacity = kBlockSize;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    bool eof = false;
+
+    bool fill() {
+        if (begin > 0) {
+            std::memmove(buffer.get(), buffer.get() + begin, end - begin);
+            end -= begin;
+            begin = 0;
+        }
+        if (end == capacity) {
+            auto grown = std::make_unique<char[]>(capacity * 2);
+            std::memcpy(grown.get(), buffer.get(), end);
+            buffer = std::move(grown);
+            capacity *= 2;
+        }
+        ssize_t n;
+        do {
+            n = ::read(fd, buffer.get() + end, capacity - end);
+        } while (n < 0 && errno == EINTR);
+        if (n <= 0) {
+            eof = true;
+            return false;
+        }
+        end += static_cast<std::size_t>(n);
+        return true;
+    }
+
+public:
+    // Reads standard input.
+    LineReader() : fd(STDIN_FILENO), ownsFd(false), buffer(new char[kBlockSize]) {}
+
+    explicit LineReader(const char* path)
+        : fd(::open(path, O_RDONLY)), ownsFd(true), buffer(new char[kBlockSize]) {}
+
+    ~LineReader() {
+        if (ownsFd && fd >= 0) ::close(fd);
+    }
+
+    LineReader(const LineReader&) = delete;
+    LineReader& operator=(const LineReader&) = delete;
+
+    bool isOpen() const { return fd >= 0; }
+
+    bool next(std::string_view& line) {
+        std::size_t scanned = begin;
+        for (;;) {
+            auto* start = buffer.get() + scanned;
+            auto* newline = static_cast<char*>(std::memchr(start, '\n', end - scanned));
+            if (newline) {
+                std::size_t lineEnd = static_cast<std::size_t>(newline - buffer.get());
+                line = std::string_view(buffer.get() + begin, lineEnd - begin);
+                begin = lineEnd + 1;
+                break;
+            }
+            if (eof) {
+                if (begin == end) return false;
+                line = std::string_view(buffer.get() + begin, end - begin);
+                begin = end;
+                break;
+            }
+            std::size_t offset = end - begin;
+            fill();
+            scanned = begin + offset;
+        }
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        return true;
+    }
+};
+
+} // namespace client
+
+#endif
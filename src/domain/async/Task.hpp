@@ -0,0 +1,124 @@
+#ifndef TASK_HPP
+#define TASK_HPP
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace domain {
+
+template <typename T = void>
+class Task;
+
+namespace detail {
+
+struct TaskPromiseBase {
+    std::coroutine_handle<> continuation = std::noop_coroutine();
+    std::exception_ptr error;
+
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept {
+            return h.promise().continuation;
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    void unhandled_exception() { error = std::current_exception(); }
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase {
+    std::optional<T> value;
+
+    Task<T> get_return_object();
+
+    template <typename U>
+    void return_value(U&& v) { value.emplace(std::forward<U>(v)); }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase {
+    Task<void> get_return_object();
+
+    void return_void() {}
+};
+
+} // namespace detail
+
+// Lazily started coroutine. Awaiting a Task starts it and resumes the
+// awaiting coroutine (by symmetric transfer) once it completes.
+template <typename T>
+class Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    Task() = default;
+    explicit Task(handle_type h) : coro(h) {}
+
+    Task(Task&& other) noexcept : coro(std::exchange(other.coro, {})) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (coro) coro.destroy();
+            coro = std::exchange(other.coro, {});
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        if (coro) coro.destroy();
+    }
+
+    bool valid() const { return static_cast<bool>(coro); }
+    bool done() const { return !coro || coro.done(); }
+
+    T result() {
+        if (coro.promise().error) {
+            std::rethrow_exception(coro.promise().error);
+        }
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(*coro.promise().value);
+        }
+    }
+
+    bool await_ready() const { return done(); }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) {
+        coro.promise().continuation = awaiting;
+        return coro;
+    }
+
+    T await_resume() { return result(); }
+
+private:
+    handle_type coro;
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() {
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() {
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+} // namespace detail
+
+} // namespace domain
+
+#endif
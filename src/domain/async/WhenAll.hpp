@@ -0,0 +1,135 @@
+#ifndef WHEN_ALL_HPP
+#define WHEN_ALL_HPP
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Task.hpp"
+
+namespace domain {
+
+namespace detail {
+
+// Counts the tasks still running plus one for the awaiting coroutine, so
+// whoever arrives last, a task or the awaiter itself, resumes it.
+struct WhenAllLatch {
+    std::atomic<std::size_t> remaining;
+    std::coroutine_handle<> awaiting;
+
+    explicit WhenAllLatch(std::size_t tasks) : remaining(tasks + 1) {}
+
+    bool arrive() { return remaining.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+};
+
+template <typename T>
+struct WhenAllSlot {
+    std::optional<T> value;
+    std::exception_ptr error;
+};
+
+class WhenAllDriver {
+public:
+    struct promise_type {
+        WhenAllLatch* latch = nullptr;
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+                WhenAllLatch* latch = h.promise().latch;
+                if (latch->arrive()) return latch->awaiting;
+                return std::noop_coroutine();
+            }
+
+            void await_resume() noexcept {}
+        };
+
+        WhenAllDriver get_return_object() {
+            return WhenAllDriver(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        FinalAwaiter final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    explicit WhenAllDriver(std::coroutine_handle<promise_type> h) : coro(h) {}
+    WhenAllDriver(WhenAllDriver&& other) noexcept : coro(std::exchange(other.coro, {})) {}
+    WhenAllDriver(const WhenAllDriver&) = delete;
+    WhenAllDriver& operator=(const WhenAllDriver&) = delete;
+    WhenAllDriver& operator=(WhenAllDriver&&) = delete;
+
+    ~WhenAllDriver() {
+        if (coro) coro.destroy();
+    }
+
+    void start(WhenAllLatch& latch) {
+        coro.promise().latch = &latch;
+        coro.resume();
+    }
+
+private:
+    std::coroutine_handle<promise_type> coro;
+};
+
+template <typename T>
+WhenAllDriver driveInto(Task<T>& task, WhenAllSlot<T>& slot) {
+    try {
+        T value = co_await task;
+        slot.value.emplace(std::move(value));
+    } catch (...) {
+        slot.error = std::current_exception();
+    }
+}
+
+struct WhenAllAwaiter {
+    std::vector<WhenAllDriver>& drivers;
+    WhenAllLatch& latch;
+
+    bool await_ready() const noexcept { return drivers.empty(); }
+
+    bool await_suspend(std::coroutine_handle<> h) {
+        latch.awaiting = h;
+        for (auto& driver : drivers) driver.start(latch);
+        return !latch.arrive();
+    }
+
+    void await_resume() const noexcept {}
+};
+
+} // namespace detail
+
+// Starts every task at once and completes when all of them have, with the
+// results in task order. Each task runs on the calling thread until its
+// first suspension, so tasks waiting on I/O or timers overlap; the awaiting
+// coroutine resumes on the thread that finishes the last one. The first
+// exception, in task order, is rethrown after all have finished.
+template <typename T>
+Task<std::vector<T>> whenAll(std::vector<Task<T>> tasks) {
+    std::vector<detail::WhenAllSlot<T>> slots(tasks.size());
+    std::vector<detail::WhenAllDriver> drivers;
+    drivers.reserve(tasks.size());
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        drivers.push_back(detail::driveInto(tasks[i], slots[i]));
+    }
+
+    detail::WhenAllLatch latch(tasks.size());
+    co_await detail::WhenAllAwaiter{drivers, latch};
+
+    std::vector<T> results;
+    results.reserve(slots.size());
+    for (auto& slot : slots) {
+        if (slot.error) std::rethrow_exception(slot.error);
+        results.push_back(std::move(*slot.value));
+    }
+    co_return results;
+}
+
+} // namespace domain
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef MPSC_RING_BUFFER_HPP
+#define MPSC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace domain {
+
+// Bounded lock-free queue for many producers and one consumer (Vyukov's
+// sequence-numbered ring). Slots are preallocated and reused, so payloads
+// are filled in place and nothing is allocated after construction.
+template <typename T>
+class MpscRingBuffer {
+private:
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    std::size_t mask;
+    alignas(64) std::atomic<std::uint64_t> head{0};
+    alignas(64) std::atomic<std::uint64_t> tail{0};
+
+    static std::size_t roundUp(std::size_t n) {
+        std::size_t size = 2;
+        while (size < n) size <<= 1;
+        return size;
+    }
+
+public:
+    explicit MpscRingBuffer(std::size_t capacity)
+        : slots(new Slot[roundUp(capacity)]), mask(roundUp(capacity) - 1)
+    {
+        for (std::size_t i = 0; i <= mask; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t capacity() const { return mask + 1; }
+
+    // Calls fill(T&) on a claimed slot; returns false if the ring is full.
+    template <typename Fill>
+    bool tryPush(Fill&& fill) {
+        auto pos = head.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[pos & mask];
+            auto seq = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::int64_t>(seq) - static_cast<std::int64_t>(pos);
+            if (diff == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    fill(slot.value);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer only. Calls consume(T&) on the oldest element, if any.
+    template <typename Consume>
+    bool tryPop(Consume&& consume) {
+        auto pos = tail.load(std::memory_order_relaxed);
+        Slot& slot = slots[pos & mask];
+        auto seq = slot.sequence.load(std::memory_order_acquire);
+        if (static_cast<std::int64_t>(seq) - static_cast<std::int64_t>(pos + 1) < 0) {
+            return false;
+        }
+        consume(slot.value);
+        slot.sequence.store(pos + mask + 1, std::memory_order_release);
+        tail.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+};
+
+} // namespace domain
+
+#endif
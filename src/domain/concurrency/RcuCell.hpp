@@ -0,0 +1,108 @@
+#ifndef RCU_CELL_HPP
+#define RCU_CELL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace domain {
+
+// Holds an immutable snapshot of T that readers access without locks.
+// Writers copy the current snapshot, modify the copy, publish it atomically
+// and free the old one only after every reader that could still see it has
+// left its read section (two-phase epoch flip, as in userspace RCU).
+template <typename T>
+class RcuCell {
+private:
+    static constexpr std::size_t kShards = 16;
+
+    struct alignas(64) ReaderCount {
+        std::atomic<std::int64_t> value{0};
+    };
+
+    std::atomic<const T*> current;
+    std::atomic<std::uint64_t> epoch{0};
+    ReaderCount readers[2][kShards];
+    std::mutex writeMutex;
+
+    static std::size_t shardIndex() {
+        thread_local const std::size_t index =
+            std::hash<std::thread::id>{}(std::this_thread::get_id()) % kShards;
+        return index;
+    }
+
+    void synchronize() {
+        for (int phase = 0; phase < 2; ++phase) {
+            auto parity = epoch.fetch_add(1, std::memory_order_seq_cst) & 1;
+            for (auto& shard : readers[parity]) {
+                while (shard.value.load(std::memory_order_seq_cst) != 0) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+
+public:
+    class ReadGuard {
+    private:
+        const T* value;
+        ReaderCount* count;
+
+    public:
+        ReadGuard(const T* v, ReaderCount* c) : value(v), count(c) {}
+        ReadGuard(ReadGuard&& other) noexcept
+            : value(other.value), count(std::exchange(other.count, nullptr)) {}
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        ReadGuard& operator=(ReadGuard&&) = delete;
+
+        ~ReadGuard() {
+            if (count) count->value.fetch_sub(1, std::memory_order_release);
+        }
+
+        const T& operator*() const { return *value; }
+        const T* operator->() const { return value; }
+    };
+
+    explicit RcuCell(T initial = T()) : current(new T(std::move(initial))) {}
+
+    RcuCell(const RcuCell&) = delete;
+    RcuCell& operator=(const RcuCell&) = delete;
+
+    ~RcuCell() {
+        delete current.load(std::memory_order_acquire);
+    }
+
+    // Wait-free: one fetch_add on a per-thread shard and one load.
+    ReadGuard read() {
+        auto parity = epoch.load(std::memory_order_seq_cst) & 1;
+        auto* count = &readers[parity][shardIndex()];
+        count->value.fetch_add(1, std::memory_order_seq_cst);
+        return ReadGuard(current.load(std::memory_order_seq_cst), count);
+    }
+
+    // Applies mutate to a private copy; publishes it if mutate returns true.
+    // Blocks only other writers, until pre-existing readers drain; must not
+    // be called while the same thread holds a ReadGuard.
+    template <typename Mutator>
+    bool update(Mutator mutate) {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        auto next = std::make_unique<T>(*current.load(std::memory_order_acquire));
+        if (!mutate(*next)) {
+            return false;
+        }
+        const T* old = current.exchange(next.release(), std::memory_order_seq_cst);
+        synchronize();
+        delete old;
+        return true;
+    }
+};
+
+} // namespace domain
+
+#endif
@@ -5,6 +5,7 @@
 #include <string>
 
 #include "../builder/CustomerBuilder.hpp"
+#include "../models/EnumNames.hpp"
 #include "../models/Enums.hpp"
 
 namespace domain {
@@ -38,11 +39,7 @@ public:
     }
 
     static std::string getTypeName(CustomerType type) {
-        switch(type) {
-            case CustomerType::PREMIUM: return "Premium";
-            case CustomerType::VIP: return "VIP";
-            default: return "Regular";
-        }
+        return std::string(enumnames::displayName(type));
     }
 };
 
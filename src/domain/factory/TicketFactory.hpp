@@ -5,6 +5,7 @@
 #include <string>
 
 #include "../builder/TicketBuilder.hpp"
+#include "../models/EnumNames.hpp"
 #include "../models/Enums.hpp"
 
 namespace domain {
@@ -60,34 +61,15 @@ public:
     }
 
     static std::string getCategoryName(TicketCategory c) {
-        switch(c) {
-            case TicketCategory::TECHNICAL: return "Technical";
-            case TicketCategory::BILLING: return "Billing";
-            case TicketCategory::GENERAL: return "General";
-            case TicketCategory::COMPLAINT: return "Complaint";
-            case TicketCategory::FEATURE_REQUEST: return "Feature Request";
-        }
-        return "Unknown";
+        return std::string(enumnames::displayName(c));
     }
 
     static std::string getPriorityName(Priority p) {
-        switch(p) {
-            case Priority::LOW: return "Low";
-            case Priority::MEDIUM: return "Medium";
-            case Priority::HIGH: return "High";
-            case Priority::CRITICAL: return "Critical";
-        }
-        return "Unknown";
+        return std::string(enumnames::displayName(p));
     }
 
     static std::string getStatusName(TicketStatus s) {
-        switch(s) {
-            case TicketStatus::OPEN: return "Open";
-            case TicketStatus::IN_PROGRESS: return "In Progress";
-            case TicketStatus::RESOLVED: return "Resolved";
-            case TicketStatus::CLOSED: return "Closed";
-        }
-        return "Unknown";
+        return std::string(enumnames::displayName(s));
     }
 };
 
@@ -0,0 +1,22 @@
+#ifndef I_ASYNC_NOTIFICATION_CHANNEL_HPP
+#define I_ASYNC_NOTIFICATION_CHANNEL_HPP
+
+#include <string>
+#include "../async/Task.hpp"
+
+namespace domain {
+
+class IAsyncNotificationChannel {
+public:
+    virtual ~IAsyncNotificationChannel() = default;
+
+    // Arguments are taken by value: the returned task may outlive the caller's strings.
+    virtual Task<bool> sendAsync(std::string recipient,
+                                 std::string message) = 0;
+
+    virtual std::string getChannelName() const = 0;
+};
+
+} // namespace domain
+
+#endif
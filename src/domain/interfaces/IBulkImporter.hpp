@@ -0,0 +1,42 @@
+#ifndef I_BULK_IMPORTER_HPP
+#define I_BULK_IMPORTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace domain {
+
+struct ImportError {
+    std::size_t line;
+    std::string message;
+};
+
+struct ImportReport {
+    static constexpr std::size_t kMaxErrors = 100;
+
+    bool opened = false;
+    std::size_t rows = 0;
+    std::size_t imported = 0;
+    std::size_t failed = 0;
+    double seconds = 0;
+    std::int64_t highestIdNumber = 0;  // largest numeric id suffix seen
+    std::vector<ImportError> errors;   // first kMaxErrors, in line order
+
+    double rowsPerSecond() const {
+        return seconds > 0 ? static_cast<double>(rows) / seconds : 0.0;
+    }
+};
+
+class IBulkImporter {
+public:
+    virtual ~IBulkImporter() = default;
+
+    virtual ImportReport importCustomers(const std::string& path) = 0;
+    virtual ImportReport importTickets(const std::string& path) = 0;
+};
+
+} // namespace domain
+
+#endif
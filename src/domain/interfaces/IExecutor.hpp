@@ -0,0 +1,17 @@
+#ifndef I_EXECUTOR_HPP
+#define I_EXECUTOR_HPP
+
+#include "../async/Task.hpp"
+
+namespace domain {
+
+class IExecutor {
+public:
+    virtual ~IExecutor() = default;
+
+    virtual void spawn(Task<void> task) = 0;
+};
+
+} // namespace domain
+
+#endif
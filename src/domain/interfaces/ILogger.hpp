@@ -1,14 +1,54 @@
 #ifndef I_LOGGER_HPP
 #define I_LOGGER_HPP
 
+#include <atomic>
+#include <cstddef>
 #include <string>
+#include <string_view>
+#include "../logging/LogField.hpp"
+#include "../logging/LogLevel.hpp"
+#include "../logging/LogRecord.hpp"
 
 namespace domain {
 
 class ILogger {
+private:
+    std::atomic<LogLevel> threshold{LogLevel::TRACE};
+
 public:
     virtual ~ILogger() = default;
     virtual void log(const std::string& message) = 0;
+
+    virtual void log(LogLevel level, const std::string& message) {
+        (void)level;
+        log(message);
+    }
+
+    // Receives a format id plus binary-encoded arguments (see LogRecord.hpp).
+    // Loggers that can defer formatting override this; the default formats
+    // eagerly and forwards to log().
+    virtual void logFormat(const FormatSite& site, const std::byte* args, std::size_t size) {
+        std::string message;
+        formatRecord(site.format, args, size, message);
+        log(site.level, message);
+    }
+
+    // Structured event with typed fields. Text loggers render it as
+    // "event key=value ..."; structured sinks keep the fields.
+    virtual void logEvent(LogLevel level, std::string_view event,
+                          const LogField* fields, std::size_t count)
+    {
+        std::string message;
+        formatEvent(event, fields, count, message);
+        log(level, message);
+    }
+
+    void setLevel(LogLevel level) { threshold.store(level, std::memory_order_relaxed); }
+    LogLevel getLevel() const { return threshold.load(std::memory_order_relaxed); }
+
+    bool isEnabled(LogLevel level) const {
+        return level >= threshold.load(std::memory_order_relaxed);
+    }
 };
 
 } // namespace domain
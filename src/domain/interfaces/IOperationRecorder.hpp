@@ -0,0 +1,94 @@
+#ifndef I_OPERATION_RECORDER_HPP
+#define I_OPERATION_RECORDER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace domain {
+
+enum class OperationType : std::uint8_t {
+    REGISTER_CUSTOMER,
+    CREATE_TICKET,
+    UPDATE_STATUS,
+    GET_CUSTOMER,
+    GET_TICKET,
+    CUSTOMERS_PAGE,
+    TICKETS_PAGE
+};
+
+constexpr std::size_t kOperationTypes = 7;
+
+inline const char* operationName(OperationType type) {
+    static const char* const names[kOperationTypes] = {
+        "registerCustomer", "createTicket", "updateTicketStatus", "getCustomer",
+        "getTicket", "getCustomersPage", "getTicketsPage"};
+    return names[static_cast<std::size_t>(type)];
+}
+
+// One completed CustomerService or TicketService call. Arguments by type:
+//   REGISTER_CUSTOMER : text name, email, phone; code[0] type; result id
+//   CREATE_TICKET     : text customer id, description; code priority,
+//                       category; result id (empty if the customer is unknown)
+//   UPDATE_STATUS     : text ticket id; code[0] status
+//   GET_CUSTOMER, GET_TICKET : text id
+//   CUSTOMERS_PAGE, TICKETS_PAGE : text cursor; code[0] direction; number limit
+// ok is false when the call failed or found nothing. Views are only valid
+// during record().
+struct OperationRecord {
+    using Clock = std::chrono::steady_clock;
+
+    OperationType type = OperationType::GET_CUSTOMER;
+    Clock::time_point start;
+    std::uint64_t durationNs = 0;
+    std::string_view text[3];
+    std::uint8_t code[2] = {0, 0};
+    std::uint32_t number = 0;
+    std::string result;
+    bool ok = true;
+};
+
+// Receives every service call while installed with setRecorder(). Called
+// concurrently from the threads that use the services.
+class IOperationRecorder {
+public:
+    virtual ~IOperationRecorder() = default;
+
+    virtual void record(const OperationRecord& operation) = 0;
+};
+
+// Times one service call and hands it to the recorder when it goes out of
+// scope. Without a recorder it does nothing, not even read the clock.
+class RecordedOperation {
+private:
+    IOperationRecorder* recorder;
+
+public:
+    OperationRecord op;
+
+    RecordedOperation(IOperationRecorder* target, OperationType type) : recorder(target) {
+        if (recorder) {
+            op.type = type;
+            op.start = OperationRecord::Clock::now();
+        }
+    }
+
+    ~RecordedOperation() {
+        if (!recorder) return;
+        op.durationNs = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                OperationRecord::Clock::now() - op.start).count());
+        recorder->record(op);
+    }
+
+    RecordedOperation(const RecordedOperation&) = delete;
+    RecordedOperation& operator=(const RecordedOperation&) = delete;
+
+    bool active() const { return recorder != nullptr; }
+};
+
+} // namespace domain
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef I_REQUEST_HANDLER_HPP
+#define I_REQUEST_HANDLER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace domain {
+
+struct HandleResult {
+    std::size_t consumed = 0;  // bytes of input taken by complete requests
+    bool close = false;        // close the connection once out is sent
+};
+
+// Protocol side of a network server: parses every complete request at the
+// front of input, executes it and appends the responses to out, in order.
+// An incomplete trailing request is left unconsumed for the next call.
+// Called from worker threads, at most once at a time per connection.
+class IRequestHandler {
+public:
+    virtual ~IRequestHandler() = default;
+
+    virtual HandleResult handle(std::string_view input, std::string& out) = 0;
+};
+
+} // namespace domain
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef I_TICKET_EXPORTER_HPP
+#define I_TICKET_EXPORTER_HPP
+
+#include <cstddef>
+#include <string>
+
+#include "../models/TicketFilter.hpp"
+
+namespace domain {
+
+enum class ExportFormat {
+    CSV,
+    JSON_LINES,
+    BINARY
+};
+
+struct ExportOptions {
+    ExportFormat format = ExportFormat::CSV;
+    bool compress = false;     // gzip the output stream
+    TicketFilter filter;
+};
+
+struct ExportReport {
+    bool opened = false;
+    bool writeFailed = false;  // short write or compressor error
+    std::size_t scanned = 0;
+    std::size_t rows = 0;      // tickets that matched the filter
+    std::size_t bytes = 0;     // before compression
+    std::size_t writes = 0;    // write(2) calls
+    double seconds = 0;
+
+    double bytesPerSecond() const {
+        return seconds > 0 ? static_cast<double>(bytes) / seconds : 0.0;
+    }
+};
+
+class ITicketExporter {
+public:
+    virtual ~ITicketExporter() = default;
+
+    // path "-" writes to stdout.
+    virtual ExportReport exportTickets(const std::string& path, const ExportOptions& options) = 0;
+};
+
+} // namespace domain
+
+#endif
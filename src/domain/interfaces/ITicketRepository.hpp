@@ -1,9 +1,12 @@
 #ifndef I_TICKET_REPOSITORY_HPP
 #define I_TICKET_REPOSITORY_HPP
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 #include <string>
+#include "Paging.hpp"
+#include "../metrics/MemoryUsage.hpp"
 #include "../models/Ticket.hpp"
 
 namespace domain {
@@ -15,6 +18,33 @@ public:
     virtual void save(const Ticket& ticket) = 0;
     virtual std::shared_ptr<Ticket> findById(const std::string& id) = 0;
     virtual std::vector<std::shared_ptr<Ticket>> findAll() = 0;
+
+    // Bulk insert; the repository may keep the given objects.
+    virtual void saveAll(std::vector<std::shared_ptr<Ticket>> tickets) {
+        for (auto& ticket : tickets) save(*ticket);
+    }
+
+    // Bulk insert of new tickets only: those whose id is already stored are
+    // left out, and their positions in the batch are returned.
+    virtual std::vector<std::size_t> insertAll(std::vector<std::shared_ptr<Ticket>> tickets) {
+        std::vector<std::size_t> existing;
+        for (std::size_t i = 0; i < tickets.size(); ++i) {
+            if (findById(tickets[i]->getId())) existing.push_back(i);
+            else save(*tickets[i]);
+        }
+        return existing;
+    }
+
+    // Up to limit tickets next to cursor, in id order; see Paging.hpp.
+    virtual std::vector<std::shared_ptr<Ticket>> findPage(
+        const std::string& cursor, std::size_t limit,
+        PageDirection direction = PageDirection::AFTER)
+    {
+        return paging::fromAll(findAll(), cursor, limit, direction);
+    }
+
+    // Heap held by the stored tickets; empty when the repository cannot tell.
+    virtual MemoryUsage memoryUsage() const { return {}; }
 };
 
 } // namespace domain
@@ -0,0 +1,67 @@
+#ifndef PAGING_HPP
+#define PAGING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace domain {
+
+// Keyset pagination over entities ordered by id. A cursor is the id of an
+// entity (not necessarily one that still exists): AFTER returns the first
+// limit entities with a greater id, BEFORE the last limit entities with a
+// smaller id. An empty cursor means the start (AFTER) or end (BEFORE).
+// Pages are always in ascending id order.
+enum class PageDirection {
+    AFTER,
+    BEFORE
+};
+
+namespace paging {
+
+// For repositories keyed by id in a std::map; the caller holds the lock.
+template <typename Map>
+std::vector<typename Map::mapped_type> fromMap(const Map& map, const std::string& cursor,
+                                               std::size_t limit, PageDirection direction)
+{
+    std::vector<typename Map::mapped_type> page;
+    page.reserve(std::min(limit, map.size()));
+    if (direction == PageDirection::AFTER) {
+        auto it = cursor.empty() ? map.begin() : map.upper_bound(cursor);
+        for (; it != map.end() && page.size() < limit; ++it) page.push_back(it->second);
+    } else {
+        auto it = cursor.empty() ? map.end() : map.lower_bound(cursor);
+        while (it != map.begin() && page.size() < limit) page.push_back((--it)->second);
+        std::reverse(page.begin(), page.end());
+    }
+    return page;
+}
+
+// Fallback for repositories that can only list everything.
+template <typename T>
+std::vector<std::shared_ptr<T>> fromAll(std::vector<std::shared_ptr<T>> all,
+                                        const std::string& cursor, std::size_t limit,
+                                        PageDirection direction)
+{
+    bool after = direction == PageDirection::AFTER;
+    std::erase_if(all, [&](const std::shared_ptr<T>& item) {
+        if (cursor.empty()) return false;
+        return after ? !(item->getId() > cursor) : !(item->getId() < cursor);
+    });
+    std::sort(all.begin(), all.end(), [](const std::shared_ptr<T>& a, const std::shared_ptr<T>& b) {
+        return a->getId() < b->getId();
+    });
+    if (all.size() > limit) {
+        if (after) all.resize(limit);
+        else all.erase(all.begin(), all.end() - static_cast<std::ptrdiff_t>(limit));
+    }
+    return all;
+}
+
+} // namespace paging
+
+} // namespace domain
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef LOG_HPP
+#define LOG_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "LogField.hpp"
+#include "LogLevel.hpp"
+#include "LogRecord.hpp"
+#include "LogSampler.hpp"
+#include "../interfaces/ILogger.hpp"
+
+// Lowest level compiled in, e.g. -DLOG_COMPILE_LEVEL=LOG_LEVEL_INFO.
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL LOG_LEVEL_TRACE
+#endif
+
+namespace domain {
+
+constexpr bool logCompiledIn(LogLevel level) {
+    return level >= static_cast<LogLevel>(LOG_COMPILE_LEVEL);
+}
+
+template <typename... Args>
+void logFormatted(ILogger& logger, const FormatSite& site, const Args&... args) {
+    if constexpr (sizeof...(Args) == 0) {
+        std::byte none{};
+        logger.logFormat(site, &none, 0);
+        return;
+    }
+    constexpr std::size_t kStackBytes = 512;
+    std::size_t size = (std::size_t{0} + ... + logargs::size(args));
+
+    if (size <= kStackBytes) {
+        std::byte buffer[kStackBytes];
+        std::byte* out = buffer;
+        ((out = logargs::encode(out, args)), ...);
+        (void)out;
+        logger.logFormat(site, buffer, size);
+    } else {
+        std::vector<std::byte> buffer(size);
+        std::byte* out = buffer.data();
+        ((out = logargs::encode(out, args)), ...);
+        (void)out;
+        logger.logFormat(site, buffer.data(), size);
+    }
+}
+
+template <typename... Fields>
+void logEvent(ILogger& logger, LogLevel level, std::string_view event, const Fields&... fields) {
+    if constexpr (sizeof...(Fields) == 0) {
+        logger.logEvent(level, event, nullptr, 0);
+    } else {
+        const LogField array[] = {fields...};
+        logger.logEvent(level, event, array, sizeof...(Fields));
+    }
+}
+
+template <typename... Args>
+inline void logDiscard(const Args&...) {}
+
+} // namespace domain
+
+// Logs a "{}"-style format literal with its arguments. Arguments are copied
+// as raw values; the string is only built by the logger, possibly later and
+// on another thread. logger may be a raw or smart pointer and may be null.
+// Nothing after the level check is evaluated when the level is disabled.
+#define LOG_AT(level, logger, format, ...)                                        \
+    do {                                                                          \
+        if ((logger) && (logger)->isEnabled(level)) {                             \
+            static const ::domain::FormatSite logSite_(format, level);            \
+            ::domain::logFormatted(*(logger), logSite_ __VA_OPT__(,) __VA_ARGS__); \
+        }                                                                         \
+    } while (0)
+
+#define LOG_FMT(logger, format, ...) \
+    LOG_AT(::domain::LogLevel::INFO, logger, format __VA_OPT__(,) __VA_ARGS__)
+
+// Structured event: LOG_EVENT(LogLevel::INFO, logger, "ticket.created",
+// logkeys::ticketId(id), ...). Fields are built on the stack and only when
+// the level is enabled.
+#define LOG_EVENT(level, logger, event, ...)                                           \
+    do {                                                                               \
+        if (::domain::logCompiledIn(level) && (logger) && (logger)->isEnabled(level)) { \
+            ::domain::logEvent(*(logger), level, event __VA_OPT__(,) __VA_ARGS__);     \
+        }                                                                              \
+    } while (0)
+
+// Sampled variants for hot call sites, e.g.
+//   LOG_EVENT_SAMPLED(SamplePolicy::perSecond(20), LogLevel::DEBUG, logger, "x.y", ...);
+// The policy can be overridden at runtime through LogSamplerRegistry using
+// the event name (or format literal) as the site name. Suppression counts
+// are reported at most once per report interval, checked every 64th call of
+// a thread whether or not it was suppressed, so sites that stop logging
+// (FIRST_N) still report them.
+#define LOG_EVENT_SAMPLED(policy, level, logger, event, ...)                           \
+    do {                                                                               \
+        if (::domain::logCompiledIn(level) && (logger) && (logger)->isEnabled(level)) { \
+            static ::domain::LogSampler logSampler_(event, policy);                    \
+            static thread_local ::domain::LogSampler::SiteState logSamplerState_;      \
+            if (logSampler_.sample(logSamplerState_)) {                                \
+                ::domain::logEvent(*(logger), level, event __VA_OPT__(,) __VA_ARGS__); \
+            }                                                                          \
+            logSampler_.maybeReport(*(logger), level, logSamplerState_);               \
+        }                                                                              \
+    } while (0)
+
+#define LOG_SAMPLED(policy, level, logger, format, ...)                               \
+    do {                                                                              \
+        if (::domain::logCompiledIn(level) && (logger) && (logger)->isEnabled(level)) { \
+            static ::domain::LogSampler logSampler_(format, policy);                  \
+            static thread_local ::domain::LogSampler::SiteState logSamplerState_;     \
+            if (logSampler_.sample(logSamplerState_)) {                               \
+                static const ::domain::FormatSite logSite_(format, level);            \
+                ::domain::logFormatted(*(logger), logSite_ __VA_OPT__(,) __VA_ARGS__); \
+            }                                                                         \
+            logSampler_.maybeReport(*(logger), level, logSamplerState_);              \
+        }                                                                             \
+    } while (0)
+
+// Levels below LOG_COMPILE_LEVEL expand to nothing, so neither the call nor
+// its arguments are compiled.
+// Keeps disabled arguments referenced (no unused warnings) without ever
+// evaluating them.
+#define LOG_DISABLED_(...)                                  \
+    do {                                                    \
+        if (false) ::domain::logDiscard(__VA_ARGS__);       \
+    } while (0)
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_TRACE
+#define LOG_TRACE(logger, ...) LOG_AT(::domain::LogLevel::TRACE, logger, __VA_ARGS__)
+#else
+#define LOG_TRACE(...) LOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(logger, ...) LOG_AT(::domain::LogLevel::DEBUG, logger, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) LOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(logger, ...) LOG_AT(::domain::LogLevel::INFO, logger, __VA_ARGS__)
+#else
+#define LOG_INFO(...) LOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_WARN
+#define LOG_WARN(logger, ...) LOG_AT(::domain::LogLevel::WARN, logger, __VA_ARGS__)
+#else
+#define LOG_WARN(...) LOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(logger, ...) LOG_AT(::domain::LogLevel::ERROR, logger, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) LOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef LOG_FIELD_HPP
+#define LOG_FIELD_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "LogRecord.hpp"
+
+namespace domain {
+
+// Key/value pair of a structured log event. Keys are interned at compile
+// time (see LogKey); string values are borrowed from the caller and only
+// valid for the duration of the logging call.
+struct LogField {
+    std::string_view key;
+    std::string_view jsonKey;   // "\"key\":"
+    LogArgType type;
+    std::int64_t raw = 0;
+    std::string_view text;
+};
+
+template <std::size_t N>
+struct FixedString {
+    char data[N]{};
+
+    constexpr FixedString(const char (&s)[N]) {
+        std::copy_n(s, N, data);
+    }
+
+    constexpr std::size_t size() const { return N - 1; }
+};
+
+// A field name known at compile time. Its plain and JSON-quoted spellings
+// live in static storage, so building a LogField copies two pointers.
+//   inline constexpr LogKey<"ticket_id"> ticketId;
+//   LOG_EVENT(LogLevel::INFO, logger, "ticket.created", ticketId(id));
+template <FixedString Name>
+struct LogKey {
+    static constexpr auto quoted = [] {
+        std::array<char, Name.size() + 3> out{};
+        out[0] = '"';
+        for (std::size_t i = 0; i < Name.size(); ++i) out[i + 1] = Name.data[i];
+        out[Name.size() + 1] = '"';
+        out[Name.size() + 2] = ':';
+        return out;
+    }();
+
+    static constexpr std::string_view name() { return {Name.data, Name.size()}; }
+    static constexpr std::string_view json() { return {quoted.data(), quoted.size()}; }
+
+    template <typename T>
+    LogField operator()(const T& value) const {
+        constexpr LogArgType type = logargs::typeOf<T>();
+        LogField field{name(), json(), type, 0, {}};
+        if constexpr (type == LogArgType::STRING) {
+            field.text = std::string_view(value);
+        } else if constexpr (type == LogArgType::DOUBLE) {
+            double v = static_cast<double>(value);
+            std::memcpy(&field.raw, &v, 8);
+        } else {
+            field.raw = static_cast<std::int64_t>(value);
+        }
+        return field;
+    }
+};
+
+namespace logkeys {
+
+inline constexpr LogKey<"ticket_id"> ticketId;
+inline constexpr LogKey<"customer_id"> customerId;
+inline constexpr LogKey<"channel"> channel;
+inline constexpr LogKey<"recipient"> recipient;
+inline constexpr LogKey<"latency_us"> latencyUs;
+inline constexpr LogKey<"category"> category;
+inline constexpr LogKey<"priority"> priority;
+inline constexpr LogKey<"status"> status;
+inline constexpr LogKey<"customer_type"> customerType;
+
+} // namespace logkeys
+
+// Appends text as the body of a JSON string (without the quotes).
+inline void appendJsonEscaped(std::string& out, std::string_view text) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    for (char c : text) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += "\\u00";
+                    out.push_back(kHex[(c >> 4) & 0xf]);
+                    out.push_back(kHex[c & 0xf]);
+                } else {
+                    out.push_back(c);
+                }
+        }
+    }
+}
+
+// Numbers are printed with to_chars so the JSON path never allocates once
+// out has grown to its working size.
+inline void appendFieldValue(std::string& out, const LogField& field, bool json) {
+    char buf[32];
+    switch (field.type) {
+        case LogArgType::STRING:
+            if (json) {
+                out.push_back('"');
+                appendJsonEscaped(out, field.text);
+                out.push_back('"');
+            } else {
+                out.append(field.text);
+            }
+            return;
+        case LogArgType::INT: {
+            auto r = std::to_chars(buf, buf + sizeof(buf), field.raw);
+            out.append(buf, r.ptr);
+            return;
+        }
+        case LogArgType::UINT: {
+            auto r = std::to_chars(buf, buf + sizeof(buf), static_cast<std::uint64_t>(field.raw));
+            out.append(buf, r.ptr);
+            return;
+        }
+        case LogArgType::DOUBLE: {
+            double v;
+            std::memcpy(&v, &field.raw, 8);
+            auto r = std::to_chars(buf, buf + sizeof(buf), v);
+            out.append(buf, r.ptr);
+            return;
+        }
+        case LogArgType::BOOL:
+            out += field.raw ? "true" : "false";
+            return;
+        default:
+            if (json) out.push_back('"');
+            logargs::appendValue(field.type, field.raw, out);
+            if (json) out.push_back('"');
+            return;
+    }
+}
+
+// "event key=value key=value", the rendering used by text loggers.
+inline void formatEvent(std::string_view event, const LogField* fields, std::size_t count,
+                        std::string& out)
+{
+    out.append(event);
+    for (std::size_t i = 0; i < count; ++i) {
+        out.push_back(' ');
+        out.append(fields[i].key);
+        out.push_back('=');
+        appendFieldValue(out, fields[i], false);
+    }
+}
+
+} // namespace domain
+
+#endif
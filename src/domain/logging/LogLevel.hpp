@@ -0,0 +1,41 @@
+#ifndef LOG_LEVEL_HPP
+#define LOG_LEVEL_HPP
+
+#include <cstdint>
+
+// Numeric values are shared with the preprocessor so LOG_COMPILE_LEVEL can
+// strip call sites below a threshold at compile time.
+#define LOG_LEVEL_TRACE 0
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO  2
+#define LOG_LEVEL_WARN  3
+#define LOG_LEVEL_ERROR 4
+#define LOG_LEVEL_OFF   5
+
+namespace domain {
+
+enum class LogLevel : std::uint8_t {
+    TRACE = LOG_LEVEL_TRACE,
+    DEBUG = LOG_LEVEL_DEBUG,
+    INFO = LOG_LEVEL_INFO,
+    WARN = LOG_LEVEL_WARN,
+    ERROR = LOG_LEVEL_ERROR,
+    OFF = LOG_LEVEL_OFF
+};
+
+// INFO keeps the historical "[LOG]" prefix.
+inline const char* logLevelTag(LogLevel level) {
+    switch (level) {
+        case LogLevel::TRACE: return "[TRACE] ";
+        case LogLevel::DEBUG: return "[DEBUG] ";
+        case LogLevel::INFO: return "[LOG] ";
+        case LogLevel::WARN: return "[WARN] ";
+        case LogLevel::ERROR: return "[ERROR] ";
+        case LogLevel::OFF: break;
+    }
+    return "[LOG] ";
+}
+
+} // namespace domain
+
+#endif
@@ -0,0 +1,216 @@
+#ifndef LOG_RECORD_HPP
+#define LOG_RECORD_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "LogLevel.hpp"
+#include "../models/EnumNames.hpp"
+#include "../models/Enums.hpp"
+
+namespace domain {
+
+// Process-wide table of log format strings. Each call site registers its
+// literal once and afterwards refers to it by a small integer id.
+class FormatRegistry {
+public:
+    static constexpr std::size_t kMaxFormats = 4096;
+    // Id of sites registered after the table filled up. Writers that refer
+    // to formats by id drop their records instead of guessing a format.
+    static constexpr std::uint32_t kUnregistered = 0xFFFFFFFF;
+
+private:
+    std::array<std::atomic<const char*>, kMaxFormats> formats{};
+    std::array<std::atomic<LogLevel>, kMaxFormats> levels{};
+    std::atomic<std::uint32_t> count{0};
+    std::mutex mutex;
+
+    FormatRegistry() = default;
+    FormatRegistry(const FormatRegistry&) = delete;
+    FormatRegistry& operator=(const FormatRegistry&) = delete;
+
+public:
+    static FormatRegistry& getInstance() {
+        static FormatRegistry instance;
+        return instance;
+    }
+
+    std::uint32_t add(const char* format, LogLevel level = LogLevel::INFO) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto id = count.load(std::memory_order_relaxed);
+        if (id >= kMaxFormats) {
+            return kUnregistered;
+        }
+        levels[id].store(level, std::memory_order_relaxed);
+        formats[id].store(format, std::memory_order_release);
+        count.store(id + 1, std::memory_order_release);
+        return id;
+    }
+
+    const char* get(std::uint32_t id) const {
+        if (id >= kMaxFormats) return nullptr;
+        return formats[id].load(std::memory_order_acquire);
+    }
+
+    LogLevel levelOf(std::uint32_t id) const {
+        if (id >= kMaxFormats) return LogLevel::INFO;
+        return levels[id].load(std::memory_order_relaxed);
+    }
+
+    std::uint32_t size() const { return count.load(std::memory_order_acquire); }
+};
+
+struct FormatSite {
+    const char* format;
+    LogLevel level;
+    std::uint32_t id;
+
+    explicit FormatSite(const char* fmt, LogLevel lvl = LogLevel::INFO)
+        : format(fmt), level(lvl), id(FormatRegistry::getInstance().add(fmt, lvl)) {}
+};
+
+enum class LogArgType : std::uint8_t {
+    INT,
+    UINT,
+    DOUBLE,
+    BOOL,
+    STRING,
+    CUSTOMER_TYPE,
+    TICKET_STATUS,
+    PRIORITY,
+    TICKET_CATEGORY
+};
+
+// Binary argument encoding: one type byte, then either 8 payload bytes or,
+// for strings, a 4-byte length followed by the characters.
+namespace logargs {
+
+template <typename T>
+constexpr LogArgType typeOf() {
+    using U = std::decay_t<T>;
+    if constexpr (std::is_same_v<U, bool>) return LogArgType::BOOL;
+    else if constexpr (std::is_same_v<U, CustomerType>) return LogArgType::CUSTOMER_TYPE;
+    else if constexpr (std::is_same_v<U, TicketStatus>) return LogArgType::TICKET_STATUS;
+    else if constexpr (std::is_same_v<U, Priority>) return LogArgType::PRIORITY;
+    else if constexpr (std::is_same_v<U, TicketCategory>) return LogArgType::TICKET_CATEGORY;
+    else if constexpr (std::is_enum_v<U>) return LogArgType::INT;
+    else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) return LogArgType::INT;
+    else if constexpr (std::is_integral_v<U>) return LogArgType::UINT;
+    else if constexpr (std::is_floating_point_v<U>) return LogArgType::DOUBLE;
+    else {
+        static_assert(std::is_convertible_v<const U&, std::string_view>,
+                      "unsupported log argument type");
+        return LogArgType::STRING;
+    }
+}
+
+template <typename T>
+std::size_t size(const T& value) {
+    if constexpr (typeOf<T>() == LogArgType::STRING) {
+        return 1 + sizeof(std::uint32_t) + std::string_view(value).size();
+    } else {
+        return 1 + 8;
+    }
+}
+
+template <typename T>
+std::byte* encode(std::byte* out, const T& value) {
+    constexpr LogArgType type = typeOf<T>();
+    *out++ = static_cast<std::byte>(type);
+    if constexpr (type == LogArgType::STRING) {
+        std::string_view text(value);
+        auto length = static_cast<std::uint32_t>(text.size());
+        std::memcpy(out, &length, sizeof(length));
+        std::memcpy(out + sizeof(length), text.data(), text.size());
+        return out + sizeof(length) + text.size();
+    } else if constexpr (type == LogArgType::DOUBLE) {
+        double v = static_cast<double>(value);
+        std::memcpy(out, &v, 8);
+        return out + 8;
+    } else if constexpr (type == LogArgType::UINT) {
+        std::uint64_t v = static_cast<std::uint64_t>(value);
+        std::memcpy(out, &v, 8);
+        return out + 8;
+    } else {
+        std::int64_t v = static_cast<std::int64_t>(value);
+        std::memcpy(out, &v, 8);
+        return out + 8;
+    }
+}
+
+// Appends the text of a non-string value stored as its 8-byte payload.
+inline bool appendValue(LogArgType type, std::int64_t raw, std::string& out) {
+    switch (type) {
+        case LogArgType::INT: out += std::to_string(raw); break;
+        case LogArgType::UINT: out += std::to_string(static_cast<std::uint64_t>(raw)); break;
+        case LogArgType::DOUBLE: {
+            double v;
+            std::memcpy(&v, &raw, 8);
+            out += std::to_string(v);
+            break;
+        }
+        case LogArgType::BOOL: out += raw ? "true" : "false"; break;
+        case LogArgType::CUSTOMER_TYPE:
+            out += enumnames::displayName(static_cast<CustomerType>(raw)); break;
+        case LogArgType::TICKET_STATUS:
+            out += enumnames::displayName(static_cast<TicketStatus>(raw)); break;
+        case LogArgType::PRIORITY:
+            out += enumnames::displayName(static_cast<Priority>(raw)); break;
+        case LogArgType::TICKET_CATEGORY:
+            out += enumnames::displayName(static_cast<TicketCategory>(raw)); break;
+        default: return false;
+    }
+    return true;
+}
+
+// Appends the next argument's text to out and returns the position after
+// it, or nullptr if the buffer is malformed.
+inline const std::byte* decode(const std::byte* in, const std::byte* end, std::string& out) {
+    if (in >= end) return nullptr;
+    auto type = static_cast<LogArgType>(*in++);
+    if (type == LogArgType::STRING) {
+        std::uint32_t length;
+        if (end - in < static_cast<std::ptrdiff_t>(sizeof(length))) return nullptr;
+        std::memcpy(&length, in, sizeof(length));
+        in += sizeof(length);
+        if (end - in < static_cast<std::ptrdiff_t>(length)) return nullptr;
+        out.append(reinterpret_cast<const char*>(in), length);
+        return in + length;
+    }
+    if (end - in < 8) return nullptr;
+    std::int64_t raw;
+    std::memcpy(&raw, in, 8);
+    if (!appendValue(type, raw, out)) return nullptr;
+    return in + 8;
+}
+
+} // namespace logargs
+
+// Expands each "{}" in format with the next encoded argument.
+inline void formatRecord(const char* format, const std::byte* args, std::size_t size,
+                         std::string& out)
+{
+    const std::byte* cursor = args;
+    const std::byte* end = args + size;
+    for (const char* p = format; *p; ++p) {
+        if (p[0] == '{' && p[1] == '}') {
+            const std::byte* next = cursor ? logargs::decode(cursor, end, out) : nullptr;
+            if (!next) out += "{?}";
+            cursor = next;
+            ++p;
+        } else {
+            out.push_back(*p);
+        }
+    }
+}
+
+} // namespace domain
+
+#endif
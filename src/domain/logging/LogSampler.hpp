@@ -0,0 +1,231 @@
+#ifndef LOG_SAMPLER_HPP
+#define LOG_SAMPLER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "LogField.hpp"
+#include "LogLevel.hpp"
+#include "../interfaces/ILogger.hpp"
+
+namespace domain {
+
+struct SamplePolicy {
+    enum class Mode : std::uint8_t {
+        ALL,
+        ONE_IN_N,     // every n-th occurrence, per thread
+        PER_SECOND,   // at most n per second, per thread
+        FIRST_N       // the first n occurrences process-wide, then only summaries
+    };
+
+    Mode mode = Mode::ALL;
+    std::uint32_t n = 1;
+
+    static SamplePolicy all() { return {Mode::ALL, 1}; }
+    static SamplePolicy oneIn(std::uint32_t n) { return {Mode::ONE_IN_N, std::max(n, 1u)}; }
+    static SamplePolicy perSecond(std::uint32_t n) { return {Mode::PER_SECOND, n}; }
+    static SamplePolicy firstN(std::uint32_t n) { return {Mode::FIRST_N, n}; }
+};
+
+// Decides, per call site, whether an occurrence is logged. The decision
+// only touches the calling thread's SiteState; suppressed occurrences are
+// published to the shared counter in batches and reported as a
+// "log.suppressed" event at most once per reportInterval.
+class LogSampler {
+public:
+    struct SiteState {
+        LogSampler* owner = nullptr;
+        std::uint32_t generation = 0;
+        std::uint64_t count = 0;
+        std::uint32_t windowUsed = 0;
+        std::int64_t windowEndNs = 0;
+        bool exhausted = false;
+        std::uint32_t pendingSuppressed = 0;
+        std::uint32_t reportCheck = 0;
+
+        ~SiteState() {
+            if (owner && pendingSuppressed) {
+                owner->suppressed.fetch_add(pendingSuppressed, std::memory_order_relaxed);
+            }
+        }
+    };
+
+private:
+    static constexpr std::uint32_t kPublishEvery = 64;
+    static constexpr std::uint32_t kReportCheckEvery = 64;  // power of two
+    static constexpr std::int64_t kReportIntervalNs = 10'000'000'000;
+
+    std::string_view siteName;
+    std::atomic<std::uint64_t> policyBits;
+    std::atomic<std::uint32_t> generation{1};
+    std::atomic<std::uint64_t> firstNCount{0};
+    std::atomic<std::uint64_t> suppressed{0};
+    std::atomic<std::int64_t> lastReportNs{0};
+
+    static std::uint64_t pack(SamplePolicy policy) {
+        return (static_cast<std::uint64_t>(policy.mode) << 32) | policy.n;
+    }
+
+    static std::int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    bool suppress(SiteState& state) {
+        if (++state.pendingSuppressed >= kPublishEvery) {
+            suppressed.fetch_add(state.pendingSuppressed, std::memory_order_relaxed);
+            state.pendingSuppressed = 0;
+        }
+        return false;
+    }
+
+public:
+    LogSampler(std::string_view name, SamplePolicy policy);
+
+    LogSampler(const LogSampler&) = delete;
+    LogSampler& operator=(const LogSampler&) = delete;
+
+    std::string_view name() const { return siteName; }
+
+    SamplePolicy policy() const {
+        auto bits = policyBits.load(std::memory_order_relaxed);
+        return {static_cast<SamplePolicy::Mode>(bits >> 32), static_cast<std::uint32_t>(bits)};
+    }
+
+    void setPolicy(SamplePolicy policy) {
+        policyBits.store(pack(policy), std::memory_order_relaxed);
+        firstNCount.store(0, std::memory_order_relaxed);
+        generation.fetch_add(1, std::memory_order_release);
+    }
+
+    bool sample(SiteState& state) {
+        auto gen = generation.load(std::memory_order_acquire);
+        if (state.generation != gen) {
+            auto owner = state.owner;
+            auto pending = state.pendingSuppressed;
+            state = SiteState();
+            state.owner = owner ? owner : this;
+            state.generation = gen;
+            state.pendingSuppressed = pending;
+        }
+
+        SamplePolicy p = policy();
+        switch (p.mode) {
+            case SamplePolicy::Mode::ALL:
+                return true;
+            case SamplePolicy::Mode::ONE_IN_N:
+                return state.count++ % p.n == 0 || suppress(state);
+            case SamplePolicy::Mode::PER_SECOND:
+                if (state.windowUsed < p.n) {
+                    ++state.windowUsed;
+                    return true;
+                }
+                // Budget spent: look at the clock only every 16th call.
+                if ((state.count++ & 15) != 0) return suppress(state);
+                {
+                    auto now = nowNs();
+                    if (state.windowEndNs == 0) state.windowEndNs = now + 1'000'000'000;
+                    if (now < state.windowEndNs) return suppress(state);
+                    state.windowEndNs = now + 1'000'000'000;
+                    state.windowUsed = p.n ? 1 : 0;
+                    return p.n != 0 || suppress(state);
+                }
+            case SamplePolicy::Mode::FIRST_N:
+                if (state.exhausted) return suppress(state);
+                if (firstNCount.fetch_add(1, std::memory_order_relaxed) < p.n) return true;
+                state.exhausted = true;
+                return suppress(state);
+        }
+        return true;
+    }
+
+    std::uint64_t takeSuppressed(SiteState* state = nullptr) {
+        if (state && state->pendingSuppressed) {
+            suppressed.fetch_add(state->pendingSuppressed, std::memory_order_relaxed);
+            state->pendingSuppressed = 0;
+        }
+        return suppressed.exchange(0, std::memory_order_relaxed);
+    }
+
+    // Per-call entry to report() for the logging macros: only every
+    // kReportCheckEvery-th call of a thread reads the clock and the shared
+    // report time, so the common path stays thread-local.
+    void maybeReport(ILogger& logger, LogLevel level, SiteState& state) {
+        if ((++state.reportCheck & (kReportCheckEvery - 1)) != 0) return;
+        report(logger, level, &state);
+    }
+
+    // Emits the suppressed count if there is one and the last report is
+    // older than the interval (or force is set).
+    void report(ILogger& logger, LogLevel level, SiteState* state = nullptr, bool force = false) {
+        auto now = nowNs();
+        auto last = lastReportNs.load(std::memory_order_relaxed);
+        if (!force && now - last < kReportIntervalNs) return;
+        if (!lastReportNs.compare_exchange_strong(last, now, std::memory_order_relaxed)) return;
+        auto count = takeSuppressed(state);
+        if (count == 0) return;
+        static constexpr LogKey<"site"> site;
+        static constexpr LogKey<"suppressed"> suppressedKey;
+        const LogField fields[] = {site(siteName), suppressedKey(count)};
+        logger.logEvent(level, "log.suppressed", fields, 2);
+    }
+};
+
+// Every sampled call site, so policies can be changed by name at runtime
+// and outstanding suppression counts reported on demand.
+class LogSamplerRegistry {
+private:
+    std::mutex mutex;
+    std::vector<LogSampler*> samplers;
+    std::map<std::string, SamplePolicy, std::less<>> overrides;
+
+    LogSamplerRegistry() = default;
+    LogSamplerRegistry(const LogSamplerRegistry&) = delete;
+    LogSamplerRegistry& operator=(const LogSamplerRegistry&) = delete;
+
+public:
+    static LogSamplerRegistry& getInstance() {
+        static LogSamplerRegistry instance;
+        return instance;
+    }
+
+    void add(LogSampler& sampler) {
+        std::lock_guard<std::mutex> lock(mutex);
+        samplers.push_back(&sampler);
+        auto it = overrides.find(sampler.name());
+        if (it != overrides.end()) sampler.setPolicy(it->second);
+    }
+
+    // Applies to current and future call sites named name.
+    void configure(const std::string& name, SamplePolicy policy) {
+        std::lock_guard<std::mutex> lock(mutex);
+        overrides[name] = policy;
+        for (auto* sampler : samplers) {
+            if (sampler->name() == name) sampler->setPolicy(policy);
+        }
+    }
+
+    void reportAll(ILogger& logger, LogLevel level = LogLevel::INFO) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto* sampler : samplers) {
+            sampler->report(logger, level, nullptr, true);
+        }
+    }
+};
+
+inline LogSampler::LogSampler(std::string_view name, SamplePolicy policy)
+    : siteName(name), policyBits(pack(policy))
+{
+    LogSamplerRegistry::getInstance().add(*this);
+}
+
+} // namespace domain
+
+#endif
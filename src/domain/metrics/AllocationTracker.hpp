@@ -0,0 +1,49 @@
+#ifndef ALLOCATION_TRACKER_HPP
+#define ALLOCATION_TRACKER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace domain {
+
+struct AllocationStats {
+    std::uint64_t count = 0;
+    std::uint64_t bytes = 0;  // as requested from operator new
+};
+
+// Heap allocations per thread, counted by the operator new replacements of
+// infrastructure/memory/AllocationHooks.hpp. Without the hooks linked in,
+// tracking() is false and every count stays zero.
+namespace allocation {
+
+inline constinit thread_local AllocationStats threadStats;
+inline std::atomic<bool> hooksInstalled{false};
+
+inline void onAllocate(std::size_t bytes) noexcept {
+    ++threadStats.count;
+    threadStats.bytes += bytes;
+}
+
+inline bool tracking() { return hooksInstalled.load(std::memory_order_relaxed); }
+
+} // namespace allocation
+
+// Allocations made by the calling thread since construction.
+class AllocationScope {
+private:
+    AllocationStats start = allocation::threadStats;
+
+public:
+    AllocationStats delta() const {
+        const auto& now = allocation::threadStats;
+        return {now.count - start.count, now.bytes - start.bytes};
+    }
+
+    // For allocation budgets: true when at most maxCount allocations were made.
+    bool within(std::uint64_t maxCount) const { return delta().count <= maxCount; }
+};
+
+} // namespace domain
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef CHANNEL_STATS_HPP
+#define CHANNEL_STATS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "LatencyHistogram.hpp"
+
+namespace domain {
+
+struct ChannelStatsSnapshot {
+    std::string channel;
+    std::uint64_t sent = 0;
+    std::uint64_t failed = 0;
+    std::uint64_t retried = 0;
+    std::uint64_t dropped = 0;
+    HistogramSnapshot queueLatency;
+    HistogramSnapshot sendLatency;
+};
+
+// Per-channel delivery counters. sent/failed count individual attempts,
+// retried counts attempts after the first, dropped counts notifications
+// abandoned once every attempt failed.
+class ChannelStats {
+public:
+    std::atomic<std::uint64_t> sent{0};
+    std::atomic<std::uint64_t> failed{0};
+    std::atomic<std::uint64_t> retried{0};
+    std::atomic<std::uint64_t> dropped{0};
+    LatencyHistogram queueLatency;
+    LatencyHistogram sendLatency;
+
+    ChannelStatsSnapshot snapshot(const std::string& channel) const {
+        ChannelStatsSnapshot snap;
+        snap.channel = channel;
+        snap.sent = sent.load(std::memory_order_relaxed);
+        snap.failed = failed.load(std::memory_order_relaxed);
+        snap.retried = retried.load(std::memory_order_relaxed);
+        snap.dropped = dropped.load(std::memory_order_relaxed);
+        snap.queueLatency = queueLatency.snapshot();
+        snap.sendLatency = sendLatency.snapshot();
+        return snap;
+    }
+};
+
+} // namespace domain
+
+#endif
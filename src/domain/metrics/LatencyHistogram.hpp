@@ -0,0 +1,110 @@
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace domain {
+
+struct HistogramSnapshot {
+    std::uint64_t count = 0;
+    std::uint64_t sum = 0;
+    std::uint64_t max = 0;
+    std::vector<std::uint64_t> buckets;
+
+    double mean() const {
+        return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+    }
+
+    std::uint64_t percentile(double p) const;
+};
+
+// Log-linear (HDR-style) histogram of nanosecond values: every power of two
+// is split into 32 linear sub-buckets, so any recorded value is reported
+// within ~3% of its true value. Recording is a handful of relaxed atomic
+// increments and never locks or allocates.
+class LatencyHistogram {
+public:
+    static constexpr unsigned kSubBucketBits = 5;
+    static constexpr std::uint64_t kSubBuckets = 1ull << kSubBucketBits;
+    static constexpr unsigned kMaxExponent = 42;
+    static constexpr std::size_t kBucketCount = (kMaxExponent - kSubBucketBits + 2) * kSubBuckets;
+
+    static std::size_t bucketIndex(std::uint64_t value) {
+        if (value < kSubBuckets) {
+            return static_cast<std::size_t>(value);
+        }
+        unsigned msb = 63u - static_cast<unsigned>(std::countl_zero(value));
+        unsigned shift = msb - kSubBucketBits;
+        std::size_t index = (shift + 1) * kSubBuckets + ((value >> shift) - kSubBuckets);
+        return std::min(index, kBucketCount - 1);
+    }
+
+    // Highest value that maps to the bucket.
+    static std::uint64_t bucketUpperBound(std::size_t index) {
+        if (index < kSubBuckets) {
+            return index;
+        }
+        std::size_t shift = index / kSubBuckets - 1;
+        std::uint64_t sub = index % kSubBuckets + kSubBuckets;
+        return ((sub + 1) << shift) - 1;
+    }
+
+    void record(std::uint64_t value) {
+        buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(value, std::memory_order_relaxed);
+        auto seen = max.load(std::memory_order_relaxed);
+        while (value > seen &&
+               !max.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    // record() for a histogram that only the calling thread writes: plain
+    // loads and stores replace the atomic read-modify-writes.
+    void recordSingleWriter(std::uint64_t value) {
+        auto& bucket = buckets[bucketIndex(value)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        if (value > max.load(std::memory_order_relaxed)) max.store(value, std::memory_order_relaxed);
+    }
+
+    HistogramSnapshot snapshot() const {
+        HistogramSnapshot snap;
+        snap.buckets.resize(kBucketCount);
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            snap.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+            snap.count += snap.buckets[i];
+        }
+        snap.sum = sum.load(std::memory_order_relaxed);
+        snap.max = max.load(std::memory_order_relaxed);
+        return snap;
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, kBucketCount> buckets{};
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> max{0};
+};
+
+inline std::uint64_t HistogramSnapshot::percentile(double p) const {
+    if (count == 0) return 0;
+    auto rank = static_cast<std::uint64_t>(p / 100.0 * static_cast<double>(count) + 0.5);
+    rank = std::clamp<std::uint64_t>(rank, 1, count);
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return std::min(LatencyHistogram::bucketUpperBound(i), max);
+        }
+    }
+    return max;
+}
+
+} // namespace domain
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef MEMORY_USAGE_HPP
+#define MEMORY_USAGE_HPP
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "../models/Customer.hpp"
+#include "../models/Ticket.hpp"
+
+namespace domain {
+
+// Heap bytes held by a store, by component. Every figure is an estimate
+// of what the allocator hands out (see memory::heapBlock), walked from
+// the live objects rather than measured.
+struct MemoryUsage {
+    std::size_t entries = 0;
+    std::size_t indexBytes = 0;   // map nodes, with their keys
+    std::size_t entityBytes = 0;  // make_shared blocks: control block and object
+    std::size_t stringBytes = 0;  // field strings that do not fit inline
+    std::size_t tagBytes = 0;     // tag vectors and their strings
+
+    std::size_t total() const { return indexBytes + entityBytes + stringBytes + tagBytes; }
+
+    double bytesPerEntry() const {
+        return entries ? static_cast<double>(total()) / static_cast<double>(entries) : 0.0;
+    }
+
+    MemoryUsage& operator+=(const MemoryUsage& other) {
+        entries += other.entries;
+        indexBytes += other.indexBytes;
+        entityBytes += other.entityBytes;
+        stringBytes += other.stringBytes;
+        tagBytes += other.tagBytes;
+        return *this;
+    }
+};
+
+namespace memory {
+
+// Size of the chunk glibc malloc uses for a request: an 8-byte header,
+// rounded up to 16 bytes, at least 32.
+constexpr std::size_t heapBlock(std::size_t requested) {
+    std::size_t chunk = (requested + 8 + 15) & ~std::size_t{15};
+    return chunk < 32 ? 32 : chunk;
+}
+
+// Heap buffer of a string, or 0 when it is stored inline (SSO).
+inline std::size_t stringHeap(const std::string& s) {
+    const char* data = s.data();
+    const char* self = reinterpret_cast<const char*>(&s);
+    if (data >= self && data < self + sizeof(s)) return 0;
+    return heapBlock(s.capacity() + 1);
+}
+
+// A red-black tree node: colour and three links, then the value.
+template <typename Map>
+constexpr std::size_t mapNodeBytes() {
+    return heapBlock(4 * sizeof(void*) + sizeof(typename Map::value_type));
+}
+
+// make_shared puts the use/weak counts and a vtable pointer before the object.
+template <typename T>
+constexpr std::size_t sharedBlockBytes() {
+    return heapBlock(sizeof(void*) + 2 * sizeof(int) + sizeof(T));
+}
+
+inline void addEntity(MemoryUsage& usage, const Customer& customer) {
+    usage.entityBytes += sharedBlockBytes<Customer>();
+    usage.stringBytes += stringHeap(customer.getId()) + stringHeap(customer.getName())
+                       + stringHeap(customer.getEmail()) + stringHeap(customer.getPhone());
+}
+
+inline void addEntity(MemoryUsage& usage, const Ticket& ticket) {
+    usage.entityBytes += sharedBlockBytes<Ticket>();
+    usage.stringBytes += stringHeap(ticket.getId()) + stringHeap(ticket.getCustomerId())
+                       + stringHeap(ticket.getDescription()) + stringHeap(ticket.getAssignedTo());
+    auto& tags = ticket.getTags();
+    if (tags.capacity()) usage.tagBytes += heapBlock(tags.capacity() * sizeof(std::string));
+    for (auto& tag : tags) usage.tagBytes += stringHeap(tag);
+}
+
+// Usage of a std::map from id to shared entity. Entities shared with
+// other owners are counted here all the same.
+template <typename T>
+MemoryUsage ofMap(const std::map<std::string, std::shared_ptr<T>>& map) {
+    using Map = std::map<std::string, std::shared_ptr<T>>;
+    MemoryUsage usage;
+    usage.entries = map.size();
+    for (auto& [id, entity] : map) {
+        usage.indexBytes += mapNodeBytes<Map>() + stringHeap(id);
+        if (entity) addEntity(usage, *entity);
+    }
+    return usage;
+}
+
+} // namespace memory
+
+} // namespace domain
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "LatencyHistogram.hpp"
+
+namespace domain {
+
+namespace metrics {
+
+// Metrics are split into shards. The first (shards - 1) threads that
+// record each own a shard and update it with plain loads and stores; any
+// later thread uses the last shard with atomic read-modify-writes.
+constexpr std::size_t kCounterShards = 32;
+constexpr std::size_t kHistogramShards = 16;
+
+inline std::size_t threadIndex() {
+    static std::atomic<std::size_t> next{0};
+    thread_local std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+} // namespace metrics
+
+// Monotonic count, one cache line per shard; value() adds them up.
+class Counter {
+private:
+    struct alignas(64) Cell {
+        std::atomic<std::uint64_t> value{0};
+    };
+
+    std::array<Cell, metrics::kCounterShards> cells;
+
+public:
+    void inc(std::uint64_t n = 1) {
+        std::size_t index = metrics::threadIndex();
+        if (index < cells.size() - 1) {
+            auto& v = cells[index].value;
+            v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        } else {
+            cells.back().value.fetch_add(n, std::memory_order_relaxed);
+        }
+    }
+
+    std::uint64_t value() const {
+        std::uint64_t total = 0;
+        for (auto& cell : cells) total += cell.value.load(std::memory_order_relaxed);
+        return total;
+    }
+};
+
+// Value that goes up and down, such as a queue depth.
+class Gauge {
+private:
+    std::atomic<std::int64_t> current{0};
+
+public:
+    void set(std::int64_t value) { current.store(value, std::memory_order_relaxed); }
+    void add(std::int64_t delta) { current.fetch_add(delta, std::memory_order_relaxed); }
+    std::int64_t value() const { return current.load(std::memory_order_relaxed); }
+};
+
+// Nanosecond distribution, a LatencyHistogram per shard; snapshot() merges
+// them.
+class Histogram {
+private:
+    std::array<LatencyHistogram, metrics::kHistogramShards> shards;
+
+public:
+    void record(std::uint64_t ns) {
+        std::size_t index = metrics::threadIndex();
+        if (index < shards.size() - 1) shards[index].recordSingleWriter(ns);
+        else shards.back().record(ns);
+    }
+
+    HistogramSnapshot snapshot() const {
+        HistogramSnapshot merged = shards[0].snapshot();
+        for (std::size_t s = 1; s < shards.size(); ++s) {
+            auto snap = shards[s].snapshot();
+            merged.count += snap.count;
+            merged.sum += snap.sum;
+            merged.max = std::max(merged.max, snap.max);
+            for (std::size_t i = 0; i < merged.buckets.size(); ++i) merged.buckets[i] += snap.buckets[i];
+        }
+        return merged;
+    }
+};
+
+} // namespace domain
+
+#endif
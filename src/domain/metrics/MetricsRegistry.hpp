@@ -0,0 +1,161 @@
+#ifndef METRICS_REGISTRY_HPP
+#define METRICS_REGISTRY_HPP
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Metrics.hpp"
+
+namespace domain {
+
+namespace metrics {
+
+// key="value", with the value escaped for the Prometheus text format.
+inline std::string label(std::string_view key, std::string_view value) {
+    std::string text(key);
+    text += "=\"";
+    for (char c : value) {
+        if (c == '\\' || c == '"') text += '\\';
+        if (c == '\n') text += "\\n";
+        else text += c;
+    }
+    text += '"';
+    return text;
+}
+
+} // namespace metrics
+
+enum class MetricType { COUNTER, GAUGE, HISTOGRAM };
+
+// One series at collection time. labels is the inside of the braces,
+// e.g. operation="createTicket", and may be empty.
+struct MetricSample {
+    std::string name;
+    std::string help;
+    std::string labels;
+    MetricType type = MetricType::COUNTER;
+    double value = 0;
+    HistogramSnapshot histogram;  // HISTOGRAM only, in nanoseconds
+};
+
+// Process-wide set of named metrics. Components register their metrics
+// once, typically in a constructor, and keep the returned reference; asking
+// again for the same name and labels returns the same metric. Registration
+// locks, recording never does.
+class MetricsRegistry {
+public:
+    using Collector = std::function<void(std::vector<MetricSample>&)>;
+
+private:
+    struct Entry {
+        std::string name;
+        std::string help;
+        std::string labels;
+        MetricType type;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+        std::function<double()> read;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<Entry>> entries;
+    std::vector<Collector> collectors;
+
+    MetricsRegistry() = default;
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    // Caller holds the lock.
+    Entry& find(const std::string& name, const std::string& labels, MetricType type,
+                const std::string& help)
+    {
+        for (auto& e : entries) {
+            if (e->name == name && e->labels == labels && e->type == type) return *e;
+        }
+        entries.push_back(std::make_unique<Entry>(Entry{name, help, labels, type, {}, {}, {}, {}}));
+        return *entries.back();
+    }
+
+public:
+    static MetricsRegistry& getInstance() {
+        static MetricsRegistry instance;
+        return instance;
+    }
+
+    Counter& counter(const std::string& name, const std::string& help,
+                     const std::string& labels = "")
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& e = find(name, labels, MetricType::COUNTER, help);
+        if (!e.counter) e.counter = std::make_unique<Counter>();
+        return *e.counter;
+    }
+
+    Gauge& gauge(const std::string& name, const std::string& help,
+                 const std::string& labels = "")
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& e = find(name, labels, MetricType::GAUGE, help);
+        if (!e.gauge) e.gauge = std::make_unique<Gauge>();
+        return *e.gauge;
+    }
+
+    Histogram& histogram(const std::string& name, const std::string& help,
+                         const std::string& labels = "")
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& e = find(name, labels, MetricType::HISTOGRAM, help);
+        if (!e.histogram) e.histogram = std::make_unique<Histogram>();
+        return *e.histogram;
+    }
+
+    // Gauge computed at collection time, such as the size of a store. read
+    // must stay callable for the life of the process.
+    void gauge(const std::string& name, const std::string& help, const std::string& labels,
+               std::function<double()> read)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& e = find(name, labels, MetricType::GAUGE, help);
+        if (!e.gauge && !e.read) e.read = std::move(read);
+    }
+
+    // For components that already keep their own statistics; the collector
+    // appends samples each time metrics are collected.
+    void addCollector(Collector collector) {
+        std::lock_guard<std::mutex> lock(mutex);
+        collectors.push_back(std::move(collector));
+    }
+
+    // Every series, grouped by name.
+    std::vector<MetricSample> collect() const {
+        std::vector<MetricSample> samples;
+        std::vector<Collector> extra;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            samples.reserve(entries.size());
+            for (auto& e : entries) {
+                MetricSample s{e->name, e->help, e->labels, e->type, 0, {}};
+                if (e->counter) s.value = static_cast<double>(e->counter->value());
+                else if (e->gauge) s.value = static_cast<double>(e->gauge->value());
+                else if (e->read) s.value = e->read();
+                else if (e->histogram) s.histogram = e->histogram->snapshot();
+                samples.push_back(std::move(s));
+            }
+            extra = collectors;
+        }
+        for (auto& collector : extra) collector(samples);
+        std::stable_sort(samples.begin(), samples.end(),
+                         [](const MetricSample& a, const MetricSample& b) { return a.name < b.name; });
+        return samples;
+    }
+};
+
+} // namespace domain
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef OPERATION_METRICS_HPP
+#define OPERATION_METRICS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "AllocationTracker.hpp"
+#include "MetricsRegistry.hpp"
+#include "../interfaces/IOperationRecorder.hpp"
+
+namespace domain {
+
+// Calls, failures, latency and heap allocations of one service operation,
+// labelled with its operationName(). The allocation counters exist only
+// when the allocation hooks are linked in (see AllocationTracker.hpp).
+struct OperationMetrics {
+    Counter* calls;
+    Counter* failures;
+    Histogram* latency;
+    Counter* allocations;
+    Counter* allocatedBytes;
+
+    static OperationMetrics of(OperationType type) {
+        auto& registry = MetricsRegistry::getInstance();
+        std::string labels = metrics::label("operation", operationName(type));
+        bool tracked = allocation::tracking();
+        return {&registry.counter("service_operations_total", "Service calls", labels),
+                &registry.counter("service_operation_failures_total",
+                                  "Service calls that failed or found nothing", labels),
+                &registry.histogram("service_operation_duration_seconds",
+                                    "Service call latency", labels),
+                tracked ? &registry.counter("service_operation_allocations_total",
+                                           "Heap allocations made by service calls", labels)
+                        : nullptr,
+                tracked ? &registry.counter("service_operation_allocated_bytes_total",
+                                           "Heap bytes requested by service calls", labels)
+                        : nullptr};
+    }
+};
+
+// Counts and times one service call when it goes out of scope.
+class TimedOperation {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    const OperationMetrics& metrics;
+    Clock::time_point start;
+    AllocationScope allocated;
+    bool ok = true;
+
+public:
+    explicit TimedOperation(const OperationMetrics& m) : metrics(m), start(Clock::now()) {}
+
+    ~TimedOperation() {
+        if (metrics.allocations) {
+            auto delta = allocated.delta();
+            metrics.allocations->inc(delta.count);
+            metrics.allocatedBytes->inc(delta.bytes);
+        }
+        metrics.latency->record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()));
+        metrics.calls->inc();
+        if (!ok) metrics.failures->inc();
+    }
+
+    TimedOperation(const TimedOperation&) = delete;
+    TimedOperation& operator=(const TimedOperation&) = delete;
+
+    void fail() { ok = false; }
+};
+
+} // namespace domain
+
+#endif
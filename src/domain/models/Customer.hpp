@@ -22,10 +22,10 @@ public:
              CustomerType type)
         : id(id), name(name), email(email), phone(phone), type(type) {}
 
-    std::string getId() const { return id; }
-    std::string getName() const { return name; }
-    std::string getEmail() const { return email; }
-    std::string getPhone() const { return phone; }
+    const std::string& getId() const { return id; }
+    const std::string& getName() const { return name; }
+    const std::string& getEmail() const { return email; }
+    const std::string& getPhone() const { return phone; }
     CustomerType getType() const { return type; }
 };
 
@@ -0,0 +1,99 @@
+#ifndef ENUM_NAMES_HPP
+#define ENUM_NAMES_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+
+#include "Enums.hpp"
+
+namespace domain {
+
+// Machine spelling of the enums for data formats (CSV, JSON, HTTP), in
+// enumerator order, and the display names shown to people.
+namespace enumnames {
+
+inline constexpr std::string_view kCustomerTypes[] = {"REGULAR", "PREMIUM", "VIP"};
+inline constexpr std::string_view kPriorities[] = {"LOW", "MEDIUM", "HIGH", "CRITICAL"};
+inline constexpr std::string_view kCategories[] = {
+    "TECHNICAL", "BILLING", "GENERAL", "COMPLAINT", "FEATURE_REQUEST"};
+inline constexpr std::string_view kStatuses[] = {"OPEN", "IN_PROGRESS", "RESOLVED", "CLOSED"};
+
+inline std::string_view name(CustomerType v) { return kCustomerTypes[static_cast<int>(v)]; }
+inline std::string_view name(Priority v) { return kPriorities[static_cast<int>(v)]; }
+inline std::string_view name(TicketCategory v) { return kCategories[static_cast<int>(v)]; }
+inline std::string_view name(TicketStatus v) { return kStatuses[static_cast<int>(v)]; }
+
+inline std::string_view displayName(CustomerType v) {
+    switch (v) {
+        case CustomerType::PREMIUM: return "Premium";
+        case CustomerType::VIP: return "VIP";
+        default: return "Regular";
+    }
+}
+
+inline std::string_view displayName(TicketCategory v) {
+    switch (v) {
+        case TicketCategory::TECHNICAL: return "Technical";
+        case TicketCategory::BILLING: return "Billing";
+        case TicketCategory::GENERAL: return "General";
+        case TicketCategory::COMPLAINT: return "Complaint";
+        case TicketCategory::FEATURE_REQUEST: return "Feature Request";
+    }
+    return "Unknown";
+}
+
+inline std::string_view displayName(Priority v) {
+    switch (v) {
+        case Priority::LOW: return "Low";
+        case Priority::MEDIUM: return "Medium";
+        case Priority::HIGH: return "High";
+        case Priority::CRITICAL: return "Critical";
+    }
+    return "Unknown";
+}
+
+inline std::string_view displayName(TicketStatus v) {
+    switch (v) {
+        case TicketStatus::OPEN: return "Open";
+        case TicketStatus::IN_PROGRESS: return "In Progress";
+        case TicketStatus::RESOLVED: return "Resolved";
+        case TicketStatus::CLOSED: return "Closed";
+    }
+    return "Unknown";
+}
+
+inline bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    return a.size() == b.size() &&
+           std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+               return (x | 0x20) == (y | 0x20);
+           });
+}
+
+// Accepts the numeric code or the name in any case.
+template <typename Enum, std::size_t N>
+bool parse(std::string_view text, const std::string_view (&names)[N], Enum& value) {
+    int code = -1;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), code);
+    if (result.ec != std::errc() || result.ptr != text.data() + text.size()) {
+        code = -1;
+        for (std::size_t i = 0; i < N; ++i) {
+            if (equalsIgnoreCase(text, names[i])) code = static_cast<int>(i);
+        }
+    }
+    if (code < 0 || code >= static_cast<int>(N)) return false;
+    value = static_cast<Enum>(code);
+    return true;
+}
+
+inline bool parse(std::string_view text, CustomerType& v) { return parse(text, kCustomerTypes, v); }
+inline bool parse(std::string_view text, Priority& v) { return parse(text, kPriorities, v); }
+inline bool parse(std::string_view text, TicketCategory& v) { return parse(text, kCategories, v); }
+inline bool parse(std::string_view text, TicketStatus& v) { return parse(text, kStatuses, v); }
+
+} // namespace enumnames
+
+} // namespace domain
+
+#endif
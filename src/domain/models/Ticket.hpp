@@ -33,15 +33,15 @@ public:
         createdAt = std::time(nullptr);
     }
 
-    std::string getId() const { return id; }
-    std::string getCustomerId() const { return customerId; }
-    std::string getDescription() const { return description; }
+    const std::string& getId() const { return id; }
+    const std::string& getCustomerId() const { return customerId; }
+    const std::string& getDescription() const { return description; }
     TicketStatus getStatus() const { return status; }
     Priority getPriority() const { return priority; }
     TicketCategory getCategory() const { return category; }
-    std::string getAssignedTo() const { return assignedTo; }
+    const std::string& getAssignedTo() const { return assignedTo; }
     std::time_t getCreatedAt() const { return createdAt; }
-    std::vector<std::string> getTags() const { return tags; }
+    const std::vector<std::string>& getTags() const { return tags; }
 
     void setStatus(TicketStatus s) { status = s; }
     void setPriority(Priority p) { priority = p; }
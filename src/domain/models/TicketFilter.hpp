@@ -0,0 +1,34 @@
+#ifndef TICKET_FILTER_HPP
+#define TICKET_FILTER_HPP
+
+#include <optional>
+#include <string>
+
+#include "Enums.hpp"
+#include "Ticket.hpp"
+
+namespace domain {
+
+// Conjunction of optional ticket predicates; an empty filter matches all.
+struct TicketFilter {
+    std::optional<TicketStatus> status;
+    std::optional<Priority> priority;
+    std::optional<TicketCategory> category;
+    std::string customerId;
+
+    bool empty() const {
+        return !status && !priority && !category && customerId.empty();
+    }
+
+    bool matches(const Ticket& ticket) const {
+        if (status && ticket.getStatus() != *status) return false;
+        if (priority && ticket.getPriority() != *priority) return false;
+        if (category && ticket.getCategory() != *category) return false;
+        if (!customerId.empty() && ticket.getCustomerId() != customerId) return false;
+        return true;
+    }
+};
+
+} // namespace domain
+
+#endif
@@ -1,14 +1,23 @@
 #ifndef CUSTOMER_SERVICE_HPP
 #define CUSTOMER_SERVICE_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "../interfaces/ICustomerRepository.hpp"
 #include "../interfaces/ILogger.hpp"
+#include "../interfaces/IOperationRecorder.hpp"
+#include "../logging/Log.hpp"
+#include "../metrics/OperationMetrics.hpp"
 #include "../factory/CustomerFactory.hpp"
 #include "../models/Customer.hpp"
 #include "../models/Enums.hpp"
+#include "../tracing/Tracer.hpp"
 
 namespace domain {
 
@@ -16,19 +25,31 @@ class CustomerService {
 private:
     ICustomerRepository& repository;
     std::shared_ptr<ILogger> logger;
-    int counter = 1000;
+    std::shared_ptr<IOperationRecorder> recorder;
+    std::atomic<std::int64_t> counter{1000};
+    OperationMetrics registerMetrics = OperationMetrics::of(OperationType::REGISTER_CUSTOMER);
+    OperationMetrics getMetrics = OperationMetrics::of(OperationType::GET_CUSTOMER);
+    OperationMetrics pageMetrics = OperationMetrics::of(OperationType::CUSTOMERS_PAGE);
 
 public:
     CustomerService(ICustomerRepository& repo,
                     std::shared_ptr<ILogger> logger)
         : repository(repo), logger(logger) {}
 
+    // Install before the service is shared between threads.
+    void setRecorder(std::shared_ptr<IOperationRecorder> operationRecorder) {
+        recorder = std::move(operationRecorder);
+    }
+
     std::string registerCustomer(const std::string& name,
                                  const std::string& email,
                                  const std::string& phone,
                                  CustomerType type = CustomerType::REGULAR)
     {
-        std::string id = "CUST-" + std::to_string(++counter);
+        TraceSpan span("CustomerService::registerCustomer");
+        TimedOperation timed(registerMetrics);
+        RecordedOperation recorded(recorder.get(), OperationType::REGISTER_CUSTOMER);
+        std::string id = "CUST-" + std::to_string(counter.fetch_add(1, std::memory_order_relaxed) + 1);
 
         auto customer = CustomerFactory::createCustomer(
             id, name, email, phone, type
@@ -36,21 +57,63 @@ public:
 
         repository.save(*customer);
 
-        if (logger) {
-            logger->log("Registered customer " + id + " (" +
-                        CustomerFactory::getTypeName(type) + ")");
-        }
+        LOG_EVENT(LogLevel::INFO, logger, "customer.registered",
+                  logkeys::customerId(id), logkeys::customerType(type));
 
+        if (recorded.active()) {
+            recorded.op.text[0] = name;
+            recorded.op.text[1] = email;
+            recorded.op.text[2] = phone;
+            recorded.op.code[0] = static_cast<std::uint8_t>(type);
+            recorded.op.result = id;
+        }
         return id;
     }
 
+    // Keeps generated ids clear of imported ones such as CUST-<lastUsed>.
+    void reserveIds(std::int64_t lastUsed) {
+        std::int64_t seen = counter.load(std::memory_order_relaxed);
+        while (lastUsed > seen &&
+               !counter.compare_exchange_weak(seen, lastUsed,
+                                              std::memory_order_relaxed)) {
+        }
+    }
+
     std::shared_ptr<Customer> getCustomer(const std::string& id) {
-        return repository.findById(id);
+        TraceSpan span("CustomerService::getCustomer");
+        TimedOperation timed(getMetrics);
+        RecordedOperation recorded(recorder.get(), OperationType::GET_CUSTOMER);
+        auto customer = repository.findById(id);
+        if (!customer) timed.fail();
+        if (recorded.active()) {
+            recorded.op.text[0] = id;
+            recorded.op.ok = customer != nullptr;
+        }
+        return customer;
     }
 
     std::vector<std::shared_ptr<Customer>> getAllCustomers() {
         return repository.findAll();
     }
+
+    std::vector<std::shared_ptr<Customer>> getCustomersPage(
+        const std::string& cursor, std::size_t limit,
+        PageDirection direction = PageDirection::AFTER)
+    {
+        TraceSpan span("CustomerService::getCustomersPage");
+        TimedOperation timed(pageMetrics);
+        RecordedOperation recorded(recorder.get(), OperationType::CUSTOMERS_PAGE);
+        if (recorded.active()) {
+            recorded.op.text[0] = cursor;
+            recorded.op.code[0] = static_cast<std::uint8_t>(direction);
+            recorded.op.number = static_cast<std::uint32_t>(std::min<std::size_t>(limit, UINT32_MAX));
+        }
+        return repository.findPage(cursor, limit, direction);
+    }
+
+    MemoryUsage memoryUsage() const {
+        return repository.memoryUsage();
+    }
 };
 
 } // namespace domain
@@ -1,22 +1,191 @@
 #ifndef NOTIFICATION_SERVICE_HPP
 #define NOTIFICATION_SERVICE_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "../async/Task.hpp"
+#include "../async/WhenAll.hpp"
+#include "../concurrency/RcuCell.hpp"
 #include "../interfaces/INotificationChannel.hpp"
+#include "../interfaces/IAsyncNotificationChannel.hpp"
+#include "../interfaces/IExecutor.hpp"
 #include "../interfaces/ILogger.hpp"
+#include "../logging/Log.hpp"
+#include "../metrics/ChannelStats.hpp"
+#include "../metrics/MetricsRegistry.hpp"
+#include "../tracing/Tracer.hpp"
 
 namespace domain {
 
 class NotificationService {
 private:
-    std::vector<std::shared_ptr<INotificationChannel>> channels;
+    using Clock = std::chrono::steady_clock;
+
+    template <typename Channel>
+    struct Registered {
+        std::shared_ptr<Channel> channel;
+        std::shared_ptr<ChannelStats> stats;
+    };
+
+    struct ChannelSet {
+        std::vector<Registered<INotificationChannel>> channels;
+        std::vector<Registered<IAsyncNotificationChannel>> asyncChannels;
+    };
+
+    RcuCell<ChannelSet> registry;
+    std::shared_ptr<IExecutor> executor;
     std::shared_ptr<ILogger> logger;
+    std::atomic<int> maxAttempts{1};
+    Gauge& inFlight = MetricsRegistry::getInstance().gauge(
+        "notification_async_in_flight", "Async deliveries spawned and not yet finished");
 
     NotificationService(std::shared_ptr<ILogger> log)
-        : logger(log) {}
+        : logger(log)
+    {
+        MetricsRegistry::getInstance().addCollector([this](std::vector<MetricSample>& out) {
+            collectStats(out);
+        });
+    }
+
+    // Exports the per-channel ChannelStats with a channel label.
+    void collectStats(std::vector<MetricSample>& out) {
+        for (auto& s : getStats()) {
+            std::string labels = metrics::label("channel", s.channel);
+            auto counter = [&](const char* name, const char* help, std::uint64_t value) {
+                out.push_back({name, help, labels, MetricType::COUNTER,
+                               static_cast<double>(value), {}});
+            };
+            counter("notification_sent_total", "Successful send attempts", s.sent);
+            counter("notification_failed_total", "Failed send attempts", s.failed);
+            counter("notification_retried_total", "Send attempts after the first", s.retried);
+            counter("notification_dropped_total", "Notifications abandoned after every attempt failed",
+                    s.dropped);
+            out.push_back({"notification_queue_delay_seconds", "Time from notify to dispatch",
+                           labels, MetricType::HISTOGRAM, 0, std::move(s.queueLatency)});
+            out.push_back({"notification_send_duration_seconds", "Duration of one send attempt",
+                           labels, MetricType::HISTOGRAM, 0, std::move(s.sendLatency)});
+        }
+    }
+
+    static std::uint64_t elapsedNs(Clock::time_point from, Clock::time_point to) {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+    }
+
+    template <typename Channel>
+    static bool eraseByName(std::vector<Registered<Channel>>& list,
+                            const std::string& name)
+    {
+        auto it = std::find_if(list.begin(), list.end(), [&](const auto& r) {
+            return r.channel->getChannelName() == name;
+        });
+        if (it == list.end()) return false;
+        list.erase(it);
+        return true;
+    }
+
+    // Keeps the existing counters so metrics survive a hot swap.
+    template <typename Channel>
+    static bool replaceByName(std::vector<Registered<Channel>>& list,
+                              const std::string& name,
+                              const std::shared_ptr<Channel>& channel)
+    {
+        for (auto& existing : list) {
+            if (existing.channel->getChannelName() == name) {
+                existing.channel = channel;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void logSent(const std::string& channelName, const std::string& recipient,
+                 Clock::time_point enqueued)
+    {
+        LOG_EVENT_SAMPLED(SamplePolicy::perSecond(50), LogLevel::DEBUG, logger,
+                          "notification.sent",
+                          logkeys::channel(channelName), logkeys::recipient(recipient),
+                          logkeys::latencyUs(elapsedNs(enqueued, Clock::now()) / 1000));
+    }
+
+    bool sendWithRetry(const Registered<INotificationChannel>& entry,
+                       const std::string& recipient,
+                       const std::string& message,
+                       Clock::time_point enqueued)
+    {
+        TraceSpan span("NotificationService::send");
+        auto& stats = *entry.stats;
+        auto dispatched = Clock::now();
+        stats.queueLatency.record(elapsedNs(enqueued, dispatched));
+
+        int attempts = maxAttempts.load(std::memory_order_relaxed);
+        for (int attempt = 0; attempt < attempts; ++attempt) {
+            if (attempt > 0) stats.retried.fetch_add(1, std::memory_order_relaxed);
+            auto begin = attempt == 0 ? dispatched : Clock::now();
+            bool ok = entry.channel->send(recipient, message);
+            stats.sendLatency.record(elapsedNs(begin, Clock::now()));
+            if (ok) {
+                stats.sent.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            stats.failed.fetch_add(1, std::memory_order_relaxed);
+        }
+        stats.dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    Task<bool> sendWithRetryAsync(Registered<IAsyncNotificationChannel> entry,
+                                  std::string recipient,
+                                  std::string message,
+                                  Clock::time_point enqueued)
+    {
+        auto& stats = *entry.stats;
+        auto dispatched = Clock::now();
+        stats.queueLatency.record(elapsedNs(enqueued, dispatched));
+
+        int attempts = maxAttempts.load(std::memory_order_relaxed);
+        for (int attempt = 0; attempt < attempts; ++attempt) {
+            if (attempt > 0) stats.retried.fetch_add(1, std::memory_order_relaxed);
+            auto begin = attempt == 0 ? dispatched : Clock::now();
+            bool ok = co_await entry.channel->sendAsync(recipient, message);
+            stats.sendLatency.record(elapsedNs(begin, Clock::now()));
+            if (ok) {
+                stats.sent.fetch_add(1, std::memory_order_relaxed);
+                co_return true;
+            }
+            stats.failed.fetch_add(1, std::memory_order_relaxed);
+        }
+        stats.dropped.fetch_add(1, std::memory_order_relaxed);
+        co_return false;
+    }
+
+    Task<bool> sendAndLog(Registered<IAsyncNotificationChannel> entry,
+                          std::string recipient,
+                          std::string message,
+                          Clock::time_point enqueued)
+    {
+        bool ok = co_await sendWithRetryAsync(entry, recipient, message, enqueued);
+        if (ok) {
+            logSent(entry.channel->getChannelName(), recipient, enqueued);
+        }
+        co_return ok;
+    }
+
+    Task<void> deliver(Registered<IAsyncNotificationChannel> entry,
+                       std::string recipient,
+                       std::string message,
+                       Clock::time_point enqueued)
+    {
+        co_await sendAndLog(std::move(entry), std::move(recipient), std::move(message), enqueued);
+        inFlight.add(-1);
+    }
 
 public:
     static NotificationService& getInstance(std::shared_ptr<ILogger> logger = nullptr) {
@@ -24,21 +193,131 @@ public:
         return instance;
     }
 
+    void setExecutor(std::shared_ptr<IExecutor> exec) {
+        executor = exec;
+    }
+
     void addChannel(std::shared_ptr<INotificationChannel> channel) {
-        channels.push_back(channel);
-        if (logger) {
-            logger->log("Added notification channel: " + channel->getChannelName());
+        registry.update([&](ChannelSet& set) {
+            set.channels.push_back({channel, std::make_shared<ChannelStats>()});
+            return true;
+        });
+        LOG_INFO(logger, "Added notification channel: {}", channel->getChannelName());
+    }
+
+    void addChannel(std::shared_ptr<IAsyncNotificationChannel> channel) {
+        if (!executor) {
+            LOG_ERROR(logger, "Cannot add async channel {}: no executor configured",
+                      channel->getChannelName());
+            return;
+        }
+        registry.update([&](ChannelSet& set) {
+            set.asyncChannels.push_back({channel, std::make_shared<ChannelStats>()});
+            return true;
+        });
+        LOG_INFO(logger, "Added async notification channel: {}", channel->getChannelName());
+    }
+
+    bool removeChannel(const std::string& name) {
+        bool removed = registry.update([&](ChannelSet& set) {
+            return eraseByName(set.channels, name) || eraseByName(set.asyncChannels, name);
+        });
+        if (removed) {
+            LOG_INFO(logger, "Removed notification channel: {}", name);
+        }
+        return removed;
+    }
+
+    // Hot-swaps the channel registered under name. Sends already in flight
+    // finish on the old instance, which is released once they complete.
+    bool replaceChannel(const std::string& name, std::shared_ptr<INotificationChannel> channel) {
+        bool replaced = registry.update([&](ChannelSet& set) {
+            return replaceByName(set.channels, name, channel);
+        });
+        if (replaced) {
+            LOG_INFO(logger, "Replaced notification channel: {}", name);
+        }
+        return replaced;
+    }
+
+    bool replaceChannel(const std::string& name, std::shared_ptr<IAsyncNotificationChannel> channel) {
+        bool replaced = registry.update([&](ChannelSet& set) {
+            return replaceByName(set.asyncChannels, name, channel);
+        });
+        if (replaced) {
+            LOG_INFO(logger, "Replaced async notification channel: {}", name);
         }
+        return replaced;
     }
 
+    std::vector<std::string> getChannelNames() {
+        auto set = registry.read();
+        std::vector<std::string> names;
+        for (auto& entry : set->channels) names.push_back(entry.channel->getChannelName());
+        for (auto& entry : set->asyncChannels) names.push_back(entry.channel->getChannelName());
+        return names;
+    }
+
+    // Total attempts per channel and notification, including the first.
+    void setMaxAttempts(int attempts) {
+        maxAttempts.store(std::max(attempts, 1), std::memory_order_relaxed);
+    }
+
+    std::vector<ChannelStatsSnapshot> getStats() {
+        auto set = registry.read();
+        std::vector<ChannelStatsSnapshot> stats;
+        for (auto& entry : set->channels) {
+            stats.push_back(entry.stats->snapshot(entry.channel->getChannelName()));
+        }
+        for (auto& entry : set->asyncChannels) {
+            stats.push_back(entry.stats->snapshot(entry.channel->getChannelName()));
+        }
+        return stats;
+    }
+
+    // Blocking channels are sent inline; async channels are spawned on the
+    // executor and complete in the background.
     void notify(const std::string& recipient, const std::string& message) {
-        for (auto& channel : channels) {
-            bool ok = channel->send(recipient, message);
-            if (ok && logger) {
-                logger->log("Notification sent via " + channel->getChannelName() +
-                            " to " + recipient);
+        TraceSpan span("NotificationService::notify");
+        auto enqueued = Clock::now();
+        auto set = registry.read();
+        for (auto& entry : set->channels) {
+            if (sendWithRetry(entry, recipient, message, enqueued)) {
+                logSent(entry.channel->getChannelName(), recipient, enqueued);
             }
         }
+        for (auto& entry : set->asyncChannels) {
+            inFlight.add(1);
+            executor->spawn(deliver(entry, recipient, message, enqueued));
+        }
+    }
+
+    // Blocking channels are sent inline; the async channels are all started
+    // at once and awaited together.
+    Task<std::size_t> notifyAsync(std::string recipient, std::string message) {
+        auto enqueued = Clock::now();
+        std::vector<Registered<IAsyncNotificationChannel>> targets;
+        std::size_t delivered = 0;
+        {
+            auto set = registry.read();
+            for (auto& entry : set->channels) {
+                if (sendWithRetry(entry, recipient, message, enqueued)) {
+                    ++delivered;
+                    logSent(entry.channel->getChannelName(), recipient, enqueued);
+                }
+            }
+            targets = set->asyncChannels;
+        }
+        std::vector<Task<bool>> sends;
+        sends.reserve(targets.size());
+        for (auto& entry : targets) {
+            sends.push_back(sendAndLog(entry, recipient, message, enqueued));
+        }
+        auto results = co_await whenAll(std::move(sends));
+        for (bool ok : results) {
+            if (ok) ++delivered;
+        }
+        co_return delivered;
     }
 };
 
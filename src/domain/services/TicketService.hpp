@@ -1,13 +1,22 @@
 #ifndef TICKET_SERVICE_HPP
 #define TICKET_SERVICE_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "../interfaces/ITicketRepository.hpp"
 #include "../interfaces/ICustomerRepository.hpp"
 #include "../interfaces/ILogger.hpp"
+#include "../interfaces/IOperationRecorder.hpp"
+#include "../logging/Log.hpp"
+#include "../metrics/OperationMetrics.hpp"
 #include "../services/NotificationService.hpp"
+#include "../tracing/Tracer.hpp"
 #include "../factory/TicketFactory.hpp"
 #include "../models/Ticket.hpp"
 #include "../models/Enums.hpp"
@@ -20,7 +29,12 @@ private:
     ICustomerRepository& customerRepo;
     NotificationService& notificationService;
     std::shared_ptr<ILogger> logger;
-    int counter = 1000;
+    std::shared_ptr<IOperationRecorder> recorder;
+    std::atomic<std::int64_t> counter{1000};
+    OperationMetrics createMetrics = OperationMetrics::of(OperationType::CREATE_TICKET);
+    OperationMetrics statusMetrics = OperationMetrics::of(OperationType::UPDATE_STATUS);
+    OperationMetrics getMetrics = OperationMetrics::of(OperationType::GET_TICKET);
+    OperationMetrics pageMetrics = OperationMetrics::of(OperationType::TICKETS_PAGE);
 
 public:
     TicketService(ITicketRepository& tr,
@@ -30,32 +44,50 @@ public:
         : ticketRepo(tr), customerRepo(cr), 
           notificationService(ns), logger(logger) {}
 
+    // Install before the service is shared between threads.
+    void setRecorder(std::shared_ptr<IOperationRecorder> operationRecorder) {
+        recorder = std::move(operationRecorder);
+    }
+
     std::string createTicket(const std::string& customerId,
                              const std::string& description,
                              Priority priority,
                              TicketCategory category = TicketCategory::GENERAL)
     {
+        TraceSpan span("TicketService::createTicket");
+        TimedOperation timed(createMetrics);
+        RecordedOperation recorded(recorder.get(), OperationType::CREATE_TICKET);
+        if (recorded.active()) {
+            recorded.op.text[0] = customerId;
+            recorded.op.text[1] = description;
+            recorded.op.code[0] = static_cast<std::uint8_t>(priority);
+            recorded.op.code[1] = static_cast<std::uint8_t>(category);
+            recorded.op.ok = false;
+        }
+
         auto customer = customerRepo.findById(customerId);
 
         if (!customer) {
-            if (logger) logger->log("Cannot create ticket: customer not found");
+            timed.fail();
+            LOG_WARN(logger, "Cannot create ticket: customer not found");
             return "";
         }
 
-        std::string id = "TKT-" + std::to_string(++counter);
+        std::string id = "TKT-" + std::to_string(counter.fetch_add(1, std::memory_order_relaxed) + 1);
 
-        auto ticket = TicketFactory::createTicket(
-            id, customerId, description, priority, category
-        );
+        std::shared_ptr<Ticket> ticket;
+        {
+            TraceSpan stage("TicketFactory::createTicket");
+            ticket = TicketFactory::createTicket(
+                id, customerId, description, priority, category
+            );
+        }
 
         ticketRepo.save(*ticket);
 
-        if (logger) {
-            logger->log("Created ticket " + id +
-                        " (Category=" + TicketFactory::getCategoryName(category) +
-                        ", Priority=" + TicketFactory::getPriorityName(priority) +
-                        ")");
-        }
+        LOG_EVENT(LogLevel::INFO, logger, "ticket.created",
+                  logkeys::ticketId(id), logkeys::customerId(customerId),
+                  logkeys::category(category), logkeys::priority(priority));
 
         std::string msg =
             "Your ticket " + id + " has been created.\n"
@@ -64,18 +96,34 @@ public:
 
         notificationService.notify(customer->getEmail(), msg);
 
+        if (recorded.active()) {
+            recorded.op.result = id;
+            recorded.op.ok = true;
+        }
         return id;
     }
 
     bool updateTicketStatus(const std::string& ticketId, TicketStatus status) {
+        TraceSpan span("TicketService::updateTicketStatus");
+        TimedOperation timed(statusMetrics);
+        RecordedOperation recorded(recorder.get(), OperationType::UPDATE_STATUS);
+        if (recorded.active()) {
+            recorded.op.text[0] = ticketId;
+            recorded.op.code[0] = static_cast<std::uint8_t>(status);
+        }
+
         auto ticket = ticketRepo.findById(ticketId);
         if (!ticket) {
-            if (logger) logger->log("Ticket not found: " + ticketId);
+            timed.fail();
+            recorded.op.ok = false;
+            LOG_WARN(logger, "Ticket not found: {}", ticketId);
             return false;
         }
 
-        ticket->setStatus(status);
-        ticketRepo.save(*ticket);
+        // Stored tickets may be read concurrently; save an updated copy
+        Ticket updated = *ticket;
+        updated.setStatus(status);
+        ticketRepo.save(updated);
 
         auto customer = customerRepo.findById(ticket->getCustomerId());
         if (customer) {
@@ -85,17 +133,57 @@ public:
             notificationService.notify(customer->getEmail(), msg);
         }
 
-        if (logger) {
-            logger->log("Ticket " + ticketId + " updated to " +
-                        TicketFactory::getStatusName(status));
-        }
+        LOG_EVENT(LogLevel::INFO, logger, "ticket.status_changed",
+                  logkeys::ticketId(ticketId), logkeys::status(status));
 
         return true;
     }
 
+    // Keeps generated ids clear of imported ones such as TKT-<lastUsed>.
+    void reserveIds(std::int64_t lastUsed) {
+        std::int64_t seen = counter.load(std::memory_order_relaxed);
+        while (lastUsed > seen &&
+               !counter.compare_exchange_weak(seen, lastUsed,
+                                              std::memory_order_relaxed)) {
+        }
+    }
+
+    std::shared_ptr<Ticket> getTicket(const std::string& id) {
+        TraceSpan span("TicketService::getTicket");
+        TimedOperation timed(getMetrics);
+        RecordedOperation recorded(recorder.get(), OperationType::GET_TICKET);
+        auto ticket = ticketRepo.findById(id);
+        if (!ticket) timed.fail();
+        if (recorded.active()) {
+            recorded.op.text[0] = id;
+            recorded.op.ok = ticket != nullptr;
+        }
+        return ticket;
+    }
+
     std::vector<std::shared_ptr<Ticket>> getAllTickets() {
         return ticketRepo.findAll();
     }
+
+    std::vector<std::shared_ptr<Ticket>> getTicketsPage(
+        const std::string& cursor, std::size_t limit,
+        PageDirection direction = PageDirection::AFTER)
+    {
+        TraceSpan span("TicketService::getTicketsPage");
+        TimedOperation timed(pageMetrics);
+        RecordedOperation recorded(recorder.get(), OperationType::TICKETS_PAGE);
+        if (recorded.active()) {
+            recorded.op.text[0] = cursor;
+            recorded.op.code[0] = static_cast<std::uint8_t>(direction);
+            recorded.op.number = static_cast<std::uint32_t>(std::min<std::size_t>(limit, UINT32_MAX));
+        }
+        return ticketRepo.findPage(cursor, limit, direction);
+    }
+
+    // Tickets only; the customers are reported by CustomerService.
+    MemoryUsage memoryUsage() const {
+        return ticketRepo.memoryUsage();
+    }
 };
 
 } // namespace domain
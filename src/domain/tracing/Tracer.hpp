@@ -0,0 +1,215 @@
+#ifndef TRACER_HPP
+#define TRACER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "../logging/LogSampler.hpp"
+
+namespace domain {
+
+// One finished span. Times are nanoseconds since the tracer started.
+struct SpanEvent {
+    const char* name;
+    std::uint32_t thread;
+    std::uint32_t depth;
+    std::uint64_t startNs;
+    std::uint64_t durationNs;
+};
+
+// Ring of the most recent spans of one thread. Only the owning thread
+// writes; snapshot() may run on any thread and skips slots overwritten
+// while it copied them.
+class SpanBuffer {
+private:
+    struct Slot {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<std::uint32_t> depth{0};
+        std::atomic<std::uint64_t> startNs{0};
+        std::atomic<std::uint64_t> durationNs{0};
+    };
+
+    std::vector<Slot> slots;
+    std::atomic<std::uint64_t> written{0};
+    std::uint32_t thread;
+
+public:
+    SpanBuffer(std::size_t capacity, std::uint32_t threadNumber)
+        : slots(capacity), thread(threadNumber) {}
+
+    void push(const char* name, std::uint32_t depth, std::uint64_t startNs, std::uint64_t durationNs) {
+        auto n = written.load(std::memory_order_relaxed);
+        // Orders the slot stores after the previous written store, so a
+        // snapshot that sees any of them also sees written >= n.
+        std::atomic_thread_fence(std::memory_order_release);
+        auto& slot = slots[n % slots.size()];
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.depth.store(depth, std::memory_order_relaxed);
+        slot.startNs.store(startNs, std::memory_order_relaxed);
+        slot.durationNs.store(durationNs, std::memory_order_relaxed);
+        written.store(n + 1, std::memory_order_release);
+    }
+
+    void snapshot(std::vector<SpanEvent>& out) const {
+        auto end = written.load(std::memory_order_acquire);
+        auto begin = end > slots.size() ? end - slots.size() : 0;
+        std::size_t first = out.size();
+        for (auto n = begin; n < end; ++n) {
+            auto& slot = slots[n % slots.size()];
+            out.push_back({slot.name.load(std::memory_order_relaxed), thread,
+                           slot.depth.load(std::memory_order_relaxed),
+                           slot.startNs.load(std::memory_order_relaxed),
+                           slot.durationNs.load(std::memory_order_relaxed)});
+        }
+        // The writer may have been overwriting the oldest copied slots
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto now = written.load(std::memory_order_relaxed);
+        auto oldestIntact = now + 1 > slots.size() ? now + 1 - slots.size() : 0;
+        if (oldestIntact > begin) {
+            auto torn = static_cast<std::ptrdiff_t>(std::min(oldestIntact, end) - begin);
+            auto from = out.begin() + static_cast<std::ptrdiff_t>(first);
+            out.erase(from, from + torn);
+        }
+    }
+};
+
+// Sampled span tracing. The outermost span on a thread decides, through
+// the "trace" LogSampler, whether the whole call tree below it is
+// recorded; spans of unsampled trees only count their depth. Recorded
+// spans go to the calling thread's SpanBuffer, and collect() gathers the
+// buffers of every thread that has traced, including finished ones. A
+// finished thread's buffer is handed to the next new thread that traces,
+// so short-lived threads (such as import workers) do not add a buffer each
+// and the "thread" of a span is really its buffer's lane.
+class Tracer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t kSpansPerThread = 8192;
+
+    struct ThreadState {
+        SpanBuffer* buffer = nullptr;
+        std::uint32_t depth = 0;
+        bool sampled = false;
+        LogSampler::SiteState sampler;
+
+        ThreadState() = default;
+        ThreadState(const ThreadState&) = delete;
+        ThreadState& operator=(const ThreadState&) = delete;
+        ~ThreadState();
+    };
+
+private:
+    std::atomic<bool> enabled{false};
+    LogSampler rootSampler{"trace", SamplePolicy::oneIn(100)};
+    Clock::time_point epoch = Clock::now();
+    std::mutex mutex;
+    std::vector<std::unique_ptr<SpanBuffer>> buffers;
+    std::vector<SpanBuffer*> idle;  // of threads that have exited
+
+    Tracer() = default;
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    SpanBuffer* addBuffer() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!idle.empty()) {
+            auto* buffer = idle.back();
+            idle.pop_back();
+            return buffer;
+        }
+        buffers.push_back(std::make_unique<SpanBuffer>(
+            kSpansPerThread, static_cast<std::uint32_t>(buffers.size() + 1)));
+        return buffers.back().get();
+    }
+
+    void releaseBuffer(SpanBuffer* buffer) {
+        std::lock_guard<std::mutex> lock(mutex);
+        idle.push_back(buffer);
+    }
+
+public:
+    static Tracer& getInstance() {
+        static Tracer instance;
+        return instance;
+    }
+
+    static ThreadState& threadState() {
+        thread_local ThreadState state;
+        return state;
+    }
+
+    // Which call trees to record, e.g. SamplePolicy::oneIn(1000); can also
+    // be changed with LogSamplerRegistry::configure("trace", ...).
+    void enable(SamplePolicy policy) {
+        rootSampler.setPolicy(policy);
+        enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void disable() { enabled.store(false, std::memory_order_relaxed); }
+
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    std::uint64_t nowNs() const {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch).count());
+    }
+
+    // Decides whether the call tree under an outermost span is recorded.
+    bool sampleRoot(ThreadState& state) { return rootSampler.sample(state.sampler); }
+
+    void record(ThreadState& state, const char* name, std::uint64_t startNs) {
+        if (!state.buffer) state.buffer = addBuffer();
+        state.buffer->push(name, state.depth, startNs, nowNs() - startNs);
+    }
+
+    std::vector<SpanEvent> collect() {
+        std::vector<SpanEvent> events;
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& buffer : buffers) buffer->snapshot(events);
+        return events;
+    }
+};
+
+inline Tracer::ThreadState::~ThreadState() {
+    if (buffer) Tracer::getInstance().releaseBuffer(buffer);
+}
+
+// Times the enclosing scope as a span named name, which must be a string
+// literal. Costs a thread_local increment when the tree is not sampled.
+class TraceSpan {
+private:
+    Tracer::ThreadState* state = nullptr;
+    const char* name;
+    std::uint64_t startNs = 0;
+    bool recording = false;
+
+public:
+    explicit TraceSpan(const char* spanName) : name(spanName) {
+        auto& tracer = Tracer::getInstance();
+        if (!tracer.isEnabled()) return;
+        state = &Tracer::threadState();
+        if (state->depth++ == 0) state->sampled = tracer.sampleRoot(*state);
+        recording = state->sampled;
+        if (recording) startNs = tracer.nowNs();
+    }
+
+    ~TraceSpan() {
+        if (!state) return;
+        --state->depth;
+        if (recording) Tracer::getInstance().record(*state, name, startNs);
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+};
+
+} // namespace domain
+
+#endif
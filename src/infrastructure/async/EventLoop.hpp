@@ -0,0 +1,226 @@
+#ifndef EVENT_LOOP_HPP
+#define EVENT_LOOP_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "../../domain/async/Task.hpp"
+#include "../../domain/interfaces/IExecutor.hpp"
+
+namespace infrastructure {
+
+// Single-threaded coroutine executor. run() drives spawned tasks on the
+// calling thread until none are left; runUntilStopped() keeps waiting for
+// new ones, so a thread running it can back setExecutor(). spawn() and
+// resumptions may be posted from any thread.
+class EventLoop : public domain::IExecutor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct Timer {
+        Clock::time_point deadline;
+        std::uint64_t sequence;
+        std::coroutine_handle<> handle;
+
+        bool operator>(const Timer& other) const {
+            if (deadline != other.deadline) return deadline > other.deadline;
+            return sequence > other.sequence;
+        }
+    };
+
+    struct Detached {
+        struct promise_type {
+            Detached get_return_object() { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+
+    struct ScheduleAwaiter {
+        EventLoop& loop;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> h) { loop.post(h); }
+        void await_resume() const noexcept {}
+    };
+
+    // Outside a running loop there is nothing to resume the coroutine, so
+    // the calling thread sleeps and the coroutine continues right away.
+    struct SleepAwaiter {
+        Clock::time_point deadline;
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> h) {
+            EventLoop* loop = current();
+            if (!loop) {
+                std::this_thread::sleep_until(deadline);
+                return false;
+            }
+            loop->addTimer(deadline, h);
+            return true;
+        }
+        void await_resume() const noexcept {}
+    };
+
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::vector<std::coroutine_handle<>> ready;
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers;
+    std::uint64_t timerSequence = 0;
+    std::atomic<std::size_t> outstanding{0};
+    std::atomic<std::size_t> failed{0};
+    std::atomic<bool> stopped{false};
+
+    static EventLoop*& currentSlot() {
+        thread_local EventLoop* loop = nullptr;
+        return loop;
+    }
+
+    class CurrentScope {
+        EventLoop* previous;
+    public:
+        explicit CurrentScope(EventLoop* loop) : previous(currentSlot()) { currentSlot() = loop; }
+        ~CurrentScope() { currentSlot() = previous; }
+    };
+
+    static Detached launch(EventLoop* loop, domain::Task<void> task) {
+        co_await ScheduleAwaiter{*loop};
+        try {
+            co_await task;
+        } catch (...) {
+            loop->failed.fetch_add(1, std::memory_order_relaxed);
+        }
+        loop->outstanding.fetch_sub(1, std::memory_order_acq_rel);
+        loop->wakeup.notify_all();
+    }
+
+    template <typename T>
+    static domain::Task<void> completeInto(domain::Task<T>& task, std::atomic<bool>& done) {
+        try {
+            co_await task;
+        } catch (...) {
+        }
+        done.store(true, std::memory_order_release);
+    }
+
+    void addTimer(Clock::time_point deadline, std::coroutine_handle<> h) {
+        std::lock_guard<std::mutex> lock(mutex);
+        timers.push(Timer{deadline, timerSequence++, h});
+    }
+
+    // Without keepAlive the loop is finished once no task is left or stop()
+    // was called; with it, only once both hold.
+    bool finished(bool keepAlive) const {
+        bool idle = outstanding.load(std::memory_order_acquire) == 0;
+        bool stopping = stopped.load(std::memory_order_relaxed);
+        return keepAlive ? idle && stopping : idle || stopping;
+    }
+
+    void runOnce(bool keepAlive = false) {
+        std::vector<std::coroutine_handle<>> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            for (;;) {
+                auto now = Clock::now();
+                while (!timers.empty() && timers.top().deadline <= now) {
+                    ready.push_back(timers.top().handle);
+                    timers.pop();
+                }
+                if (!ready.empty() || finished(keepAlive)) {
+                    break;
+                }
+                if (timers.empty()) {
+                    wakeup.wait(lock);
+                } else {
+                    wakeup.wait_until(lock, timers.top().deadline);
+                }
+            }
+            batch.swap(ready);
+        }
+        for (auto h : batch) {
+            h.resume();
+        }
+    }
+
+public:
+    EventLoop() = default;
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    static EventLoop* current() { return currentSlot(); }
+
+    void spawn(domain::Task<void> task) override {
+        outstanding.fetch_add(1, std::memory_order_acq_rel);
+        launch(this, std::move(task));
+    }
+
+    void post(std::coroutine_handle<> h) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.push_back(h);
+        }
+        wakeup.notify_one();
+    }
+
+    // Awaitables, usable from any coroutine running on an EventLoop.
+    ScheduleAwaiter yield() { return ScheduleAwaiter{*this}; }
+
+    static SleepAwaiter sleepFor(Clock::duration d) { return SleepAwaiter{Clock::now() + d}; }
+    static SleepAwaiter sleepUntil(Clock::time_point t) { return SleepAwaiter{t}; }
+
+    // Runs until every spawned task has finished or stop() is called.
+    void run() {
+        CurrentScope scope(this);
+        stopped.store(false, std::memory_order_relaxed);
+        while (!finished(false)) {
+            runOnce();
+        }
+    }
+
+    // Runs tasks as they are spawned, sleeping while there are none, until
+    // stop() is called and the tasks spawned before it have finished.
+    void runUntilStopped() {
+        CurrentScope scope(this);
+        while (!finished(true)) {
+            runOnce(true);
+        }
+        stopped.store(false, std::memory_order_relaxed);
+    }
+
+    void stop() {
+        {
+            // Under the mutex so a runOnce() about to wait cannot miss it
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped.store(true, std::memory_order_relaxed);
+        }
+        wakeup.notify_all();
+    }
+
+    // Drives the loop on the calling thread until the task completes.
+    template <typename T>
+    T syncWait(domain::Task<T> task) {
+        std::atomic<bool> done{false};
+        spawn(completeInto(task, done));
+        CurrentScope scope(this);
+        while (!done.load(std::memory_order_acquire)) {
+            runOnce();
+        }
+        return task.result();
+    }
+
+    std::size_t pendingTasks() const { return outstanding.load(std::memory_order_acquire); }
+    std::size_t failedTasks() const { return failed.load(std::memory_order_relaxed); }
+};
+
+} // namespace infrastructure
+
+#endif
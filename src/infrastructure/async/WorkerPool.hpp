@@ -0,0 +1,72 @@
+#ifndef WORKER_POOL_HPP
+#define WORKER_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace infrastructure {
+
+// Fixed set of threads running submitted jobs in FIFO order. The destructor
+// finishes the queued jobs before joining.
+class WorkerPool {
+private:
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::deque<std::function<void()>> jobs;
+    std::vector<std::thread> threads;
+    bool stopping = false;
+
+    void workerLoop() {
+        for (;;) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeup.wait(lock, [this] { return stopping || !jobs.empty(); });
+                if (jobs.empty()) return;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            job();
+        }
+    }
+
+public:
+    explicit WorkerPool(std::size_t count) {
+        if (count == 0) count = 1;
+        threads.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            threads.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeup.notify_all();
+        for (auto& t : threads) t.join();
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    void submit(std::function<void()> job) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back(std::move(job));
+        }
+        wakeup.notify_one();
+    }
+
+    std::size_t size() const { return threads.size(); }
+};
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,156 @@
+#ifndef BUFFERED_CONSOLE_SINK_HPP
+#define BUFFERED_CONSOLE_SINK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace infrastructure {
+
+struct FlushPolicy {
+    std::size_t maxBufferedBytes;
+    std::chrono::milliseconds maxDelay;
+
+    static FlushPolicy everyLine() {
+        return {0, std::chrono::milliseconds(0)};
+    }
+
+    static FlushPolicy buffered(std::size_t bytes = 64 * 1024,
+                                std::chrono::milliseconds delay = std::chrono::milliseconds(200)) {
+        return {bytes, delay};
+    }
+};
+
+// Shared line-oriented writer for console output. Lines are written to the
+// stream without std::endl and flushed by size or age instead of per line.
+// Interactive prompts still appear on time because std::cin is tied to
+// std::cout and flushes it before every read. startFlusher() adds a thread
+// that flushes lines older than maxDelay when no further output follows;
+// only use it when nothing else writes the output stream directly.
+class BufferedConsoleSink {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::mutex mutex;
+    std::ostream* out;
+    FlushPolicy policy = FlushPolicy::buffered();
+    std::size_t pendingBytes = 0;
+    Clock::time_point lastFlush = Clock::now();
+    std::string line;  // writeLine assembles here, under the lock
+    std::thread flusher;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    BufferedConsoleSink() : out(&std::cout) {}
+    BufferedConsoleSink(const BufferedConsoleSink&) = delete;
+    BufferedConsoleSink& operator=(const BufferedConsoleSink&) = delete;
+
+    void flushLocked() {
+        out->flush();
+        pendingBytes = 0;
+        lastFlush = Clock::now();
+    }
+
+    void afterWrite(std::size_t bytes) {
+        pendingBytes += bytes;
+        if (pendingBytes >= policy.maxBufferedBytes ||
+            Clock::now() - lastFlush >= policy.maxDelay) {
+            flushLocked();
+        }
+    }
+
+    void flushLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping) {
+            auto period = std::max(policy.maxDelay / 2, std::chrono::milliseconds(1));
+            if (policy.maxDelay.count() == 0) period = std::chrono::milliseconds(100);
+            wake.wait_for(lock, period);
+            if (pendingBytes > 0 && Clock::now() - lastFlush >= policy.maxDelay) {
+                flushLocked();
+            }
+        }
+    }
+
+    std::size_t put(std::string_view text) {
+        out->write(text.data(), static_cast<std::streamsize>(text.size()));
+        return text.size();
+    }
+
+public:
+    static BufferedConsoleSink& getInstance() {
+        static BufferedConsoleSink instance;
+        return instance;
+    }
+
+    ~BufferedConsoleSink() {
+        stopFlusher();
+        flush();
+    }
+
+    void setPolicy(FlushPolicy p) {
+        std::lock_guard<std::mutex> lock(mutex);
+        policy = p;
+        flushLocked();
+    }
+
+    void setOutput(std::ostream& stream) {
+        std::lock_guard<std::mutex> lock(mutex);
+        flushLocked();
+        out = &stream;
+    }
+
+    // Writes all parts followed by a newline as one uninterrupted line.
+    template <typename... Parts>
+    void writeLine(const Parts&... parts) {
+        std::lock_guard<std::mutex> lock(mutex);
+        line.clear();
+        (line.append(std::string_view(parts)), ...);
+        line.push_back('\n');
+        afterWrite(put(line));
+    }
+
+    // Writes a block of already formatted text, typically many lines at once.
+    void write(std::string_view text) {
+        std::lock_guard<std::mutex> lock(mutex);
+        afterWrite(put(text));
+    }
+
+    void startFlusher() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (flusher.joinable()) return;
+        stopping = false;
+        flusher = std::thread([this] { flushLoop(); });
+    }
+
+    void stopFlusher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        if (flusher.joinable()) flusher.join();
+    }
+
+    void flushIfStale() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pendingBytes > 0 && Clock::now() - lastFlush >= policy.maxDelay) {
+            flushLocked();
+        }
+    }
+
+    void flush() {
+        std::lock_guard<std::mutex> lock(mutex);
+        flushLocked();
+    }
+};
+
+} // namespace infrastructure
+
+#endif
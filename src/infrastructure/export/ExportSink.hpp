@@ -0,0 +1,156 @@
+#ifndef EXPORT_SINK_HPP
+#define EXPORT_SINK_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace infrastructure {
+
+// Large-block output for exports. Callers reserve room for a whole record,
+// serialize into it with plain pointer writes and commit; the buffer goes to
+// the file descriptor in one write(2) whenever it fills up.
+//
+// With compression the data is piped through "gzip -1", which writes the
+// file itself, so the exporter needs no compression library.
+class ExportSink {
+public:
+    static constexpr std::size_t kDefaultCapacity = 4 << 20;
+
+private:
+    std::unique_ptr<char[]> buffer;
+    std::size_t capacity;
+    std::size_t used = 0;
+    int fd = -1;
+    bool ownsFd = false;
+    pid_t compressor = -1;
+    bool failed = false;
+    std::size_t bytes = 0;
+    std::size_t writes = 0;
+
+    void writeAll(const char* data, std::size_t size) {
+        while (size > 0 && !failed) {
+            ssize_t n = ::write(fd, data, size);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                failed = true;
+                break;
+            }
+            ++writes;
+            data += n;
+            size -= static_cast<std::size_t>(n);
+        }
+    }
+
+    bool spawnCompressor(int fileFd) {
+        int pipeFds[2];
+        if (::pipe2(pipeFds, O_CLOEXEC) != 0) return false;
+
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, pipeFds[0], STDIN_FILENO);
+        posix_spawn_file_actions_adddup2(&actions, fileFd, STDOUT_FILENO);
+        posix_spawn_file_actions_addclose(&actions, pipeFds[1]);
+
+        char arg0[] = "gzip";
+        char arg1[] = "-1";
+        char arg2[] = "-c";
+        char* argv[] = {arg0, arg1, arg2, nullptr};
+        int rc = posix_spawnp(&compressor, "gzip", &actions, nullptr, argv, environ);
+        posix_spawn_file_actions_destroy(&actions);
+
+        ::close(pipeFds[0]);
+        if (rc != 0) {
+            compressor = -1;
+            ::close(pipeFds[1]);
+            return false;
+        }
+        fd = pipeFds[1];
+        return true;
+    }
+
+public:
+    explicit ExportSink(std::size_t bufferBytes = kDefaultCapacity)
+        : buffer(new char[bufferBytes]), capacity(bufferBytes) {}
+
+    ~ExportSink() { close(); }
+
+    ExportSink(const ExportSink&) = delete;
+    ExportSink& operator=(const ExportSink&) = delete;
+
+    // path "-" is stdout.
+    bool open(const std::string& path, bool compress) {
+        int fileFd = STDOUT_FILENO;
+        bool ownsFile = path != "-";
+        if (ownsFile) {
+            fileFd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fileFd < 0) return false;
+        }
+
+        if (compress) {
+            bool spawned = spawnCompressor(fileFd);
+            if (ownsFile) ::close(fileFd);
+            if (!spawned) return false;
+            ownsFd = true;
+        } else {
+            fd = fileFd;
+            ownsFd = ownsFile;
+        }
+        return true;
+    }
+
+    // Returns room for at least size bytes, flushing first if needed.
+    char* reserve(std::size_t size) {
+        if (capacity - used < size) {
+            flush();
+            if (size > capacity) {
+                buffer.reset(new char[size]);
+                capacity = size;
+            }
+        }
+        return buffer.get() + used;
+    }
+
+    void commit(char* end) {
+        std::size_t size = static_cast<std::size_t>(end - (buffer.get() + used));
+        used += size;
+        bytes += size;
+    }
+
+    void flush() {
+        if (used > 0 && fd >= 0) writeAll(buffer.get(), used);
+        used = 0;
+    }
+
+    // Flushes, closes the descriptor and waits for the compressor. Returns
+    // false if any write or the compressor failed.
+    bool close() {
+        if (fd < 0) return !failed;
+        flush();
+        if (ownsFd) ::close(fd);
+        fd = -1;
+        if (compressor > 0) {
+            int status = 0;
+            while (::waitpid(compressor, &status, 0) < 0 && errno == EINTR) {}
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failed = true;
+            compressor = -1;
+        }
+        return !failed;
+    }
+
+    std::size_t bytesWritten() const { return bytes; }
+    std::size_t writeCalls() const { return writes; }
+};
+
+} // namespace infrastructure
+
+#endif
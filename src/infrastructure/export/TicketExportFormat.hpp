@@ -0,0 +1,25 @@
+#ifndef TICKET_EXPORT_FORMAT_HPP
+#define TICKET_EXPORT_FORMAT_HPP
+
+#include <cstdint>
+
+namespace infrastructure {
+
+// Layout of the binary ticket export. All integers are little-endian and
+// records are unaligned:
+//   header : kMagic (8 bytes)
+//   record : u32 length of the rest of the record, then
+//            str id, str customer id, str description, str assigned to,
+//            u8 priority, u8 category, u8 status, i64 created at (unix s),
+//            u16 tag count, tag count x str
+//   str    : u32 length, length bytes
+// Enum bytes are the numeric codes of domain/models/Enums.hpp.
+namespace ticketexport {
+
+constexpr char kMagic[8] = {'C', 'P', 'T', 'K', 'E', 'X', '0', '1'};
+
+} // namespace ticketexport
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef TICKET_EXPORTER_HPP
+#define TICKET_EXPORTER_HPP
+
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "ExportSink.hpp"
+#include "TicketExportFormat.hpp"
+#include "../../domain/interfaces/ITicketExporter.hpp"
+#include "../../domain/interfaces/ITicketRepository.hpp"
+#include "../../domain/models/EnumNames.hpp"
+#include "../../domain/models/Ticket.hpp"
+
+namespace infrastructure {
+
+// Streams the ticket repository to a file in CSV, JSON lines or the binary
+// layout of TicketExportFormat.hpp. Tickets are fetched a page at a time in
+// id order, so the store is never copied as a whole and writers are only
+// held off for one page. Each record is serialized straight into the
+// ExportSink buffer.
+//
+//   CSV        : id,customer_id,description,priority,category,status
+//                (the columns CsvImporter reads back)
+//   JSON lines : one object per ticket with every field
+class TicketExporter : public domain::ITicketExporter {
+private:
+    static constexpr std::size_t kPageSize = 1024;
+
+    domain::ITicketRepository& ticketRepo;
+    std::size_t bufferBytes;
+
+    static char* put(char* p, std::string_view text) {
+        std::memcpy(p, text.data(), text.size());
+        return p + text.size();
+    }
+
+    static char* putNumber(char* p, std::int64_t value) {
+        return std::to_chars(p, p + 20, value).ptr;
+    }
+
+    template <typename T>
+    static char* putRaw(char* p, T value) {
+        std::memcpy(p, &value, sizeof(value));
+        return p + sizeof(value);
+    }
+
+    // CSV
+
+    // Checks eight bytes per step for ',', '"', '\n' or '\r'.
+    static bool needsQuotes(std::string_view text) {
+        constexpr std::uint64_t kOnes = 0x0101010101010101ULL;
+        constexpr std::uint64_t kHigh = 0x8080808080808080ULL;
+        auto hasByte = [](std::uint64_t word, unsigned char c) {
+            std::uint64_t x = word ^ (kOnes * c);
+            return (x - kOnes) & ~x & kHigh;
+        };
+        const char* p = text.data();
+        std::size_t n = text.size();
+        for (; n >= 8; p += 8, n -= 8) {
+            std::uint64_t word;
+            std::memcpy(&word, p, 8);
+            if (hasByte(word, ',') | hasByte(word, '"') |
+                hasByte(word, '\n') | hasByte(word, '\r')) return true;
+        }
+        for (; n > 0; ++p, --n) {
+            if (*p == ',' || *p == '"' || *p == '\n' || *p == '\r') return true;
+        }
+        return false;
+    }
+
+    static char* putCsvField(char* p, std::string_view text) {
+        if (!needsQuotes(text)) return put(p, text);
+        *p++ = '"';
+        for (char c : text) {
+            if (c == '"') *p++ = '"';
+            *p++ = c;
+        }
+        *p++ = '"';
+        return p;
+    }
+
+    static void writeCsv(ExportSink& sink, const domain::Ticket& t) {
+        const std::string& id = t.getId();
+        const std::string& customer = t.getCustomerId();
+        const std::string& description = t.getDescription();
+        char* p = sink.reserve(2 * (id.size() + customer.size() + description.size()) + 64);
+        p = putCsvField(p, id);
+        *p++ = ',';
+        p = putCsvField(p, customer);
+        *p++ = ',';
+        p = putCsvField(p, description);
+        *p++ = ',';
+        p = put(p, domain::enumnames::name(t.getPriority()));
+        *p++ = ',';
+        p = put(p, domain::enumnames::name(t.getCategory()));
+        *p++ = ',';
+        p = put(p, domain::enumnames::name(t.getStatus()));
+        *p++ = '\n';
+        sink.commit(p);
+    }
+
+    // JSON lines
+
+    static char* putJsonString(char* p, std::string_view text) {
+        static constexpr char kHex[] = "0123456789abcdef";
+        *p++ = '"';
+        for (char c : text) {
+            auto u = static_cast<unsigned char>(c);
+            if (u >= 0x20 && c != '"' && c != '\\') {
+                *p++ = c;
+            } else if (c == '"' || c == '\\') {
+                *p++ = '\\';
+                *p++ = c;
+            } else if (c == '\n') {
+                p = put(p, "\\n");
+            } else if (c == '\t') {
+                p = put(p, "\\t");
+            } else {
+                p = put(p, "\\u00");
+                *p++ = kHex[u >> 4];
+                *p++ = kHex[u & 0xf];
+            }
+        }
+        *p++ = '"';
+        return p;
+    }
+
+    static void writeJson(ExportSink& sink, const domain::Ticket& t) {
+        const auto& tags = t.getTags();
+        std::size_t textBytes = t.getId().size() + t.getCustomerId().size() +
+                                t.getDescription().size() + t.getAssignedTo().size();
+        for (auto& tag : tags) textBytes += tag.size() + 3;
+        char* p = sink.reserve(6 * textBytes + 256);
+
+        p = put(p, "{\"id\":");
+        p = putJsonString(p, t.getId());
+        p = put(p, ",\"customer_id\":");
+        p = putJsonString(p, t.getCustomerId());
+        p = put(p, ",\"description\":");
+        p = putJsonString(p, t.getDescription());
+        p = put(p, ",\"priority\":\"");
+        p = put(p, domain::enumnames::name(t.getPriority()));
+        p = put(p, "\",\"category\":\"");
+        p = put(p, domain::enumnames::name(t.getCategory()));
+        p = put(p, "\",\"status\":\"");
+        p = put(p, domain::enumnames::name(t.getStatus()));
+        p = put(p, "\",\"assigned_to\":");
+        p = putJsonString(p, t.getAssignedTo());
+        p = put(p, ",\"created_at\":");
+        p = putNumber(p, static_cast<std::int64_t>(t.getCreatedAt()));
+        p = put(p, ",\"tags\":[");
+        for (std::size_t i = 0; i < tags.size(); ++i) {
+            if (i) *p++ = ',';
+            p = putJsonString(p, tags[i]);
+        }
+        p = put(p, "]}\n");
+        sink.commit(p);
+    }
+
+    // Binary
+
+    static char* putString(char* p, std::string_view text) {
+        p = putRaw(p, static_cast<std::uint32_t>(text.size()));
+        return put(p, text);
+    }
+
+    static void writeBinary(ExportSink& sink, const domain::Ticket& t) {
+        const auto& tags = t.getTags();
+        std::size_t size = 4 * 4 + t.getId().size() + t.getCustomerId().size() +
+                           t.getDescription().size() + t.getAssignedTo().size() +
+                           3 + 8 + 2;
+        for (auto& tag : tags) size += 4 + tag.size();
+
+        char* p = sink.reserve(4 + size);
+        p = putRaw(p, static_cast<std::uint32_t>(size));
+        p = putString(p, t.getId());
+        p = putString(p, t.getCustomerId());
+        p = putString(p, t.getDescription());
+        p = putString(p, t.getAssignedTo());
+        p = putRaw(p, static_cast<std::uint8_t>(t.getPriority()));
+        p = putRaw(p, static_cast<std::uint8_t>(t.getCategory()));
+        p = putRaw(p, static_cast<std::uint8_t>(t.getStatus()));
+        p = putRaw(p, static_cast<std::int64_t>(t.getCreatedAt()));
+        p = putRaw(p, static_cast<std::uint16_t>(tags.size()));
+        for (auto& tag : tags) p = putString(p, tag);
+        sink.commit(p);
+    }
+
+    template <typename Write>
+    void scan(ExportSink& sink, const domain::TicketFilter& filter,
+              domain::ExportReport& report, Write write)
+    {
+        std::string after;
+        for (;;) {
+            auto page = ticketRepo.findPage(after, kPageSize);
+            for (auto& ticket : page) {
+                if (!filter.matches(*ticket)) continue;
+                write(sink, *ticket);
+                ++report.rows;
+            }
+            report.scanned += page.size();
+            if (page.size() < kPageSize) break;
+            after = page.back()->getId();
+        }
+    }
+
+public:
+    explicit TicketExporter(domain::ITicketRepository& tickets,
+                            std::size_t bufferBytes = ExportSink::kDefaultCapacity)
+        : ticketRepo(tickets), bufferBytes(bufferBytes) {}
+
+    domain::ExportReport exportTickets(const std::string& path,
+                                       const domain::ExportOptions& options) override {
+        auto start = std::chrono::steady_clock::now();
+        domain::ExportReport report;
+        ExportSink sink(bufferBytes);
+        if (!sink.open(path, options.compress)) return report;
+        report.opened = true;
+
+        switch (options.format) {
+            case domain::ExportFormat::CSV: {
+                char* p = sink.reserve(64);
+                sink.commit(put(p, "id,customer_id,description,priority,category,status\n"));
+                scan(sink, options.filter, report, writeCsv);
+                break;
+            }
+            case domain::ExportFormat::JSON_LINES:
+                scan(sink, options.filter, report, writeJson);
+                break;
+            case domain::ExportFormat::BINARY: {
+                char* p = sink.reserve(sizeof(ticketexport::kMagic));
+                sink.commit(put(p, {ticketexport::kMagic, sizeof(ticketexport::kMagic)}));
+                scan(sink, options.filter, report, writeBinary);
+                break;
+            }
+        }
+
+        report.writeFailed = !sink.close();
+        report.bytes = sink.bytesWritten();
+        report.writes = sink.writeCalls();
+        report.seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        return report;
+    }
+};
+
+} // namespace infrastructure
+
+#endif
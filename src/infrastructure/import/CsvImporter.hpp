@@ -0,0 +1,287 @@
+#ifndef CSV_IMPORTER_HPP
+#define CSV_IMPORTER_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "MappedFile.hpp"
+#include "../../domain/factory/CustomerFactory.hpp"
+#include "../../domain/factory/TicketFactory.hpp"
+#include "../../domain/interfaces/IBulkImporter.hpp"
+#include "../../domain/interfaces/ICustomerRepository.hpp"
+#include "../../domain/interfaces/ITicketRepository.hpp"
+#include "../../domain/models/EnumNames.hpp"
+#include "../../domain/models/Enums.hpp"
+
+namespace infrastructure {
+
+// Bulk CSV loader. The file is memory-mapped and cut into one chunk per
+// worker at line boundaries; each worker parses its rows, builds entities
+// through the factories and hands them to the repository in batches.
+// A bad row is recorded with its line number and skipped. So is a row
+// whose id is already stored or appeared on an earlier row; within a chunk
+// the first row wins, across chunks whichever reaches the repository first.
+//
+//   customers: id,name,email,phone,type
+//   tickets:   id,customer_id,description,priority,category[,status]
+//
+// Enum columns take the numeric code or the enumerator name (any case); an
+// empty status means OPEN.
+// Fields may be double-quoted ("" for a quote); a record cannot span lines.
+// A first line starting with "id," is treated as a header.
+class CsvImporter : public domain::IBulkImporter {
+private:
+    static constexpr std::size_t kBatchSize = 4096;
+    static constexpr std::size_t kMinChunkBytes = 1 << 20;
+    static constexpr std::size_t kMaxFields = 8;
+
+    domain::ICustomerRepository& customerRepo;
+    domain::ITicketRepository& ticketRepo;
+    unsigned workers;
+
+    struct Row {
+        std::string fields[kMaxFields];
+        std::size_t count = 0;
+    };
+
+    struct ChunkResult {
+        std::size_t lines = 0;
+        std::size_t rows = 0;
+        std::size_t imported = 0;
+        std::size_t failed = 0;
+        std::int64_t highestIdNumber = 0;
+        std::vector<domain::ImportError> errors;   // line numbers local to the chunk
+    };
+
+    // Splits one line into fields; returns false on a malformed quote or
+    // too many fields.
+    static bool parseLine(std::string_view line, Row& row) {
+        row.count = 0;
+        std::size_t i = 0;
+        for (;;) {
+            if (row.count == kMaxFields) return false;
+            std::string& field = row.fields[row.count++];
+            field.clear();
+            if (i < line.size() && line[i] == '"') {
+                ++i;
+                for (;;) {
+                    if (i >= line.size()) return false;
+                    if (line[i] == '"') {
+                        if (i + 1 < line.size() && line[i + 1] == '"') {
+                            field.push_back('"');
+                            i += 2;
+                            continue;
+                        }
+                        ++i;
+                        break;
+                    }
+                    field.push_back(line[i++]);
+                }
+                if (i < line.size() && line[i] != ',') return false;
+            } else {
+                auto comma = line.find(',', i);
+                auto end = comma == std::string_view::npos ? line.size() : comma;
+                field.assign(line.data() + i, end - i);
+                i = end;
+            }
+            if (i >= line.size()) return true;
+            ++i;  // skip ','
+        }
+    }
+
+    static std::int64_t idNumber(std::string_view id) {
+        auto dash = id.rfind('-');
+        auto digits = dash == std::string_view::npos ? id : id.substr(dash + 1);
+        std::int64_t value = 0;
+        auto result = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+        return result.ec == std::errc() ? value : 0;
+    }
+
+    static std::vector<std::string_view> splitChunks(std::string_view data, unsigned count) {
+        count = static_cast<unsigned>(std::clamp<std::size_t>(
+            data.size() / kMinChunkBytes, 1, std::max(count, 1u)));
+        std::vector<std::string_view> chunks;
+        std::size_t begin = 0;
+        for (unsigned i = 1; i <= count && begin < data.size(); ++i) {
+            std::size_t end = i == count ? data.size() : data.size() / count * i;
+            if (end < begin) end = begin;
+            if (end < data.size()) {
+                auto newline = data.find('\n', end);
+                end = newline == std::string_view::npos ? data.size() : newline + 1;
+            }
+            chunks.push_back(data.substr(begin, end - begin));
+            begin = end;
+        }
+        return chunks;
+    }
+
+    // BuildRow: bool(Row&, std::shared_ptr<T>& out, std::string& error)
+    // Flush: std::vector<std::size_t>(std::vector<std::shared_ptr<T>>),
+    //        returning the positions of entities with an existing id
+    template <typename T, typename BuildRow, typename Flush>
+    domain::ImportReport run(const std::string& path, BuildRow build, Flush flush) {
+        auto start = std::chrono::steady_clock::now();
+        domain::ImportReport report;
+        MappedFile file(path);
+        if (!file.isOpen()) return report;
+        report.opened = true;
+
+        auto chunks = splitChunks(file.view(), workers);
+        std::vector<ChunkResult> results(chunks.size());
+
+        auto work = [&](std::size_t index) {
+            ChunkResult& result = results[index];
+            Row row;
+            std::string error;
+            std::vector<std::shared_ptr<T>> batch;
+            std::vector<std::pair<std::size_t, std::string_view>> batchLines;
+            batch.reserve(kBatchSize);
+            batchLines.reserve(kBatchSize);
+
+            auto addError = [&](std::size_t line, std::string message) {
+                ++result.failed;
+                if (result.errors.size() < domain::ImportReport::kMaxErrors) {
+                    result.errors.push_back({line, std::move(message)});
+                }
+            };
+            auto flushBatch = [&] {
+                if (batch.empty()) return;
+                std::size_t count = batch.size();
+                auto existing = flush(std::move(batch));
+                result.imported += count - existing.size();
+                for (std::size_t i : existing) {
+                    Row duplicate;
+                    parseLine(batchLines[i].second, duplicate);
+                    addError(batchLines[i].first, "duplicate id '" + duplicate.fields[0] + "'");
+                }
+                batch.clear();
+                batch.reserve(kBatchSize);
+                batchLines.clear();
+            };
+
+            std::string_view rest = chunks[index];
+            while (!rest.empty()) {
+                auto newline = rest.find('\n');
+                std::string_view line = rest.substr(0, newline);
+                rest.remove_prefix(newline == std::string_view::npos ? rest.size() : newline + 1);
+                ++result.lines;
+                if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+                if (line.empty()) continue;
+                if (index == 0 && result.lines == 1 && line.substr(0, 3) == "id,") continue;
+
+                ++result.rows;
+                std::shared_ptr<T> entity;
+                error.clear();
+                if (!parseLine(line, row)) {
+                    error = "malformed CSV";
+                } else if (build(row, entity, error)) {
+                    result.highestIdNumber = std::max(result.highestIdNumber,
+                                                      idNumber(row.fields[0]));
+                    batch.push_back(std::move(entity));
+                    batchLines.emplace_back(result.lines, line);
+                    if (batch.size() == kBatchSize) flushBatch();
+                    continue;
+                }
+                addError(result.lines, error);
+            }
+            flushBatch();
+            std::sort(result.errors.begin(), result.errors.end(),
+                      [](const auto& a, const auto& b) { return a.line < b.line; });
+        };
+
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < chunks.size(); ++i) threads.emplace_back(work, i);
+        if (!chunks.empty()) work(0);
+        for (auto& t : threads) t.join();
+
+        std::size_t lineOffset = 0;
+        for (auto& result : results) {
+            report.rows += result.rows;
+            report.imported += result.imported;
+            report.failed += result.failed;
+            report.highestIdNumber = std::max(report.highestIdNumber, result.highestIdNumber);
+            for (auto& e : result.errors) {
+                if (report.errors.size() == domain::ImportReport::kMaxErrors) break;
+                report.errors.push_back({lineOffset + e.line, std::move(e.message)});
+            }
+            lineOffset += result.lines;
+        }
+        report.seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        return report;
+    }
+
+public:
+    CsvImporter(domain::ICustomerRepository& customers,
+                domain::ITicketRepository& tickets,
+                unsigned threads = std::thread::hardware_concurrency())
+        : customerRepo(customers), ticketRepo(tickets), workers(std::max(threads, 1u)) {}
+
+    domain::ImportReport importCustomers(const std::string& path) override {
+        return run<domain::Customer>(path,
+            [](Row& row, std::shared_ptr<domain::Customer>& out, std::string& error) {
+                domain::CustomerType type;
+                if (row.count != 5) {
+                    error = "expected 5 fields: id,name,email,phone,type";
+                } else if (row.fields[0].empty()) {
+                    error = "missing id";
+                } else if (!domain::enumnames::parse(row.fields[4], type)) {
+                    error = "invalid customer type '" + row.fields[4] + "'";
+                } else {
+                    out = domain::CustomerFactory::createCustomer(
+                        row.fields[0], row.fields[1], row.fields[2], row.fields[3], type);
+                    return true;
+                }
+                return false;
+            },
+            [this](std::vector<std::shared_ptr<domain::Customer>> batch) {
+                return customerRepo.insertAll(std::move(batch));
+            });
+    }
+
+    // Tickets must reference customers that are already in the repository.
+    domain::ImportReport importTickets(const std::string& path) override {
+        return run<domain::Ticket>(path,
+            [this](Row& row, std::shared_ptr<domain::Ticket>& out, std::string& error) {
+                domain::Priority priority;
+                domain::TicketCategory category;
+                domain::TicketStatus status = domain::TicketStatus::OPEN;
+                if (row.count != 5 && row.count != 6) {
+                    error = "expected 5 or 6 fields: id,customer_id,description,priority,category[,status]";
+                } else if (row.fields[0].empty()) {
+                    error = "missing id";
+                } else if (!domain::enumnames::parse(row.fields[3], priority)) {
+                    error = "invalid priority '" + row.fields[3] + "'";
+                } else if (!domain::enumnames::parse(row.fields[4], category)) {
+                    error = "invalid category '" + row.fields[4] + "'";
+                } else if (row.count == 6 && !row.fields[5].empty() &&
+                           !domain::enumnames::parse(row.fields[5], status)) {
+                    error = "invalid status '" + row.fields[5] + "'";
+                } else if (!customerRepo.findById(row.fields[1])) {
+                    error = "unknown customer '" + row.fields[1] + "'";
+                } else {
+                    out = domain::TicketFactory::createTicket(
+                        row.fields[0], row.fields[1], row.fields[2], priority, category);
+                    out->setStatus(status);
+                    return true;
+                }
+                return false;
+            },
+            [this](std::vector<std::shared_ptr<domain::Ticket>> batch) {
+                return ticketRepo.insertAll(std::move(batch));
+            });
+    }
+};
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace infrastructure {
+
+// Read-only memory mapping of a whole file.
+class MappedFile {
+private:
+    int fd = -1;
+    const char* data = nullptr;
+    std::size_t length = 0;
+    bool opened = false;
+
+public:
+    explicit MappedFile(const std::string& path) {
+        fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) return;
+        opened = true;
+        length = static_cast<std::size_t>(st.st_size);
+        if (length == 0) return;
+        void* map = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            opened = false;
+            length = 0;
+            return;
+        }
+        ::madvise(map, length, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(map);
+    }
+
+    ~MappedFile() {
+        if (data) ::munmap(const_cast<char*>(data), length);
+        if (fd >= 0) ::close(fd);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return opened; }
+    std::string_view view() const { return {data, length}; }
+};
+
+} // namespace infrastructure
+
+#endif
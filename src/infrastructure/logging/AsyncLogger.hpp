@@ -0,0 +1,95 @@
+#ifndef ASYNC_LOGGER_HPP
+#define ASYNC_LOGGER_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "RingLogger.hpp"
+#include "../../domain/logging/LogLevel.hpp"
+#include "../console/BufferedConsoleSink.hpp"
+
+namespace infrastructure {
+
+struct AsyncLogEntry {
+    static constexpr std::size_t kInlineSize = 240;
+
+    std::uint32_t length = 0;
+    domain::LogLevel level = domain::LogLevel::INFO;
+    char text[kInlineSize];
+    std::string overflow;
+};
+
+// ILogger that only copies the message into a lock-free ring; a background
+// thread formats queued messages and hands them to BufferedConsoleSink in
+// batches.
+class AsyncLogger : public RingLogger<AsyncLogEntry> {
+private:
+    static constexpr std::size_t kBatchBytes = 32 * 1024;
+
+    std::string batch;
+
+protected:
+    void consume(AsyncLogEntry& entry) override {
+        batch.append(domain::logLevelTag(entry.level));
+        if (entry.length == UINT32_MAX) {
+            batch.append(entry.overflow);
+        } else {
+            batch.append(entry.text, entry.length);
+        }
+        batch.push_back('\n');
+    }
+
+    bool batchFull() const override { return batch.size() >= kBatchBytes; }
+
+    void writeBatch() override {
+        if (!batch.empty()) {
+            BufferedConsoleSink::getInstance().write(batch);
+            batch.clear();
+        }
+    }
+
+    void onDropped(std::uint64_t count) override {
+        batch.append("[LOG] AsyncLogger dropped " + std::to_string(count) + " messages\n");
+    }
+
+public:
+    explicit AsyncLogger(std::size_t capacity = 8192,
+                         OverflowPolicy overflow = OverflowPolicy::DROP)
+        : RingLogger(capacity, overflow)
+    {
+        batch.reserve(kBatchBytes * 2);
+        start();
+    }
+
+    ~AsyncLogger() override {
+        stop();
+        BufferedConsoleSink::getInstance().flush();
+    }
+
+    void log(const std::string& message) override {
+        log(domain::LogLevel::INFO, message);
+    }
+
+    void log(domain::LogLevel level, const std::string& message) override {
+        enqueue([&](AsyncLogEntry& e) {
+            e.level = level;
+            if (message.size() <= AsyncLogEntry::kInlineSize) {
+                std::memcpy(e.text, message.data(), message.size());
+                e.length = static_cast<std::uint32_t>(message.size());
+            } else {
+                e.overflow.assign(message);
+                e.length = UINT32_MAX;
+            }
+        });
+    }
+
+    void flush() override {
+        RingLogger::flush();
+        BufferedConsoleSink::getInstance().flush();
+    }
+};
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef BINARY_LOG_FORMAT_HPP
+#define BINARY_LOG_FORMAT_HPP
+
+#include <cstdint>
+
+namespace infrastructure {
+
+// On-disk layout written by BinaryLogger and read by tools/log_decoder.
+// All integers are little-endian, records are unaligned:
+//   header  : kMagic (8 bytes)
+//   FORMAT  : u8 kind, u32 id, u8 level, u32 length, length bytes of format
+//             text
+//   EVENT   : u8 kind, u32 id, i64 unix time in ns, u32 size, size bytes of
+//             arguments encoded as in domain/logging/LogRecord.hpp
+namespace binlog {
+
+constexpr char kMagic[8] = {'C', 'P', 'B', 'L', 'O', 'G', '0', '2'};
+
+enum class RecordKind : std::uint8_t {
+    FORMAT = 1,
+    EVENT = 2
+};
+
+} // namespace binlog
+
+} // namespace infrastructure
+
+#endif
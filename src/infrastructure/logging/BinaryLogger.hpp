@@ -0,0 +1,208 @@
+#ifndef BINARY_LOGGER_HPP
+#define BINARY_LOGGER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "BinaryLogFormat.hpp"
+#include "RingLogger.hpp"
+#include "../../domain/logging/Log.hpp"
+#include "../console/BufferedConsoleSink.hpp"
+
+namespace infrastructure {
+
+struct BinaryLogEntry {
+    static constexpr std::size_t kInlineSize = 224;
+
+    std::uint32_t siteId = 0;
+    std::uint32_t size = 0;
+    std::int64_t timestampNs = 0;
+    std::byte args[kInlineSize];
+    std::vector<std::byte> overflow;
+};
+
+// Deferred-formatting logger. The caller only copies the format id and the
+// encoded arguments into the ring. The writer thread either formats them
+// as text for the console, or appends the raw records to a binary file
+// that tools/log_decoder turns back into text offline.
+class BinaryLogger : public RingLogger<BinaryLogEntry> {
+private:
+    static constexpr std::size_t kBatchBytes = 64 * 1024;
+
+    std::FILE* file = nullptr;
+    std::vector<bool> formatWritten;
+    std::string batch;
+
+    void put(const void* data, std::size_t size) {
+        batch.append(static_cast<const char*>(data), size);
+    }
+
+    template <typename T>
+    void putValue(T value) {
+        put(&value, sizeof(value));
+    }
+
+    void putFormat(std::uint32_t id) {
+        if (id >= formatWritten.size()) formatWritten.resize(id + 1, false);
+        if (formatWritten[id]) return;
+        auto& registry = domain::FormatRegistry::getInstance();
+        const char* format = registry.get(id);
+        if (!format) format = "";
+        auto length = static_cast<std::uint32_t>(std::strlen(format));
+        putValue(binlog::RecordKind::FORMAT);
+        putValue(id);
+        putValue(registry.levelOf(id));
+        putValue(length);
+        put(format, length);
+        formatWritten[id] = true;
+    }
+
+    void putEvent(std::uint32_t id, std::int64_t timestampNs,
+                  const std::byte* args, std::uint32_t size)
+    {
+        putFormat(id);
+        putValue(binlog::RecordKind::EVENT);
+        putValue(id);
+        putValue(timestampNs);
+        putValue(size);
+        put(args, size);
+    }
+
+protected:
+    void consume(BinaryLogEntry& entry) override {
+        const std::byte* args = entry.size > BinaryLogEntry::kInlineSize
+            ? entry.overflow.data() : entry.args;
+
+        if (file) {
+            putEvent(entry.siteId, entry.timestampNs, args, entry.size);
+            return;
+        }
+
+        auto& registry = domain::FormatRegistry::getInstance();
+        const char* format = registry.get(entry.siteId);
+        batch.append(domain::logLevelTag(registry.levelOf(entry.siteId)));
+        domain::formatRecord(format ? format : "{?}", args, entry.size, batch);
+        batch.push_back('\n');
+    }
+
+    bool batchFull() const override { return batch.size() >= kBatchBytes; }
+
+    void writeBatch() override {
+        if (batch.empty()) return;
+        if (file) {
+            std::fwrite(batch.data(), 1, batch.size(), file);
+        } else {
+            BufferedConsoleSink::getInstance().write(batch);
+        }
+        batch.clear();
+    }
+
+    void onDropped(std::uint64_t count) override {
+        std::string message = "BinaryLogger dropped " + std::to_string(count) + " messages";
+        if (file) {
+            static const domain::FormatSite site("{}", domain::LogLevel::WARN);
+            if (site.id == domain::FormatRegistry::kUnregistered) return;
+            std::vector<std::byte> args(domain::logargs::size(message));
+            domain::logargs::encode(args.data(), message);
+            putEvent(site.id, now(), args.data(), static_cast<std::uint32_t>(args.size()));
+        } else {
+            batch.append(domain::logLevelTag(domain::LogLevel::WARN) + message + "\n");
+        }
+    }
+
+    static std::int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+public:
+    // Formats on the writer thread and prints to the console.
+    explicit BinaryLogger(std::size_t capacity = 8192,
+                          OverflowPolicy overflow = OverflowPolicy::DROP)
+        : RingLogger(capacity, overflow)
+    {
+        batch.reserve(kBatchBytes * 2);
+        start();
+    }
+
+    // Writes undecoded binary records to path.
+    explicit BinaryLogger(const std::string& path,
+                          std::size_t capacity = 8192,
+                          OverflowPolicy overflow = OverflowPolicy::DROP)
+        : RingLogger(capacity, overflow), file(std::fopen(path.c_str(), "wb"))
+    {
+        batch.reserve(kBatchBytes * 2);
+        if (file) {
+            std::setvbuf(file, nullptr, _IOFBF, 1 << 20);
+            std::fwrite(binlog::kMagic, 1, sizeof(binlog::kMagic), file);
+        }
+        start();
+    }
+
+    ~BinaryLogger() override {
+        stop();
+        if (file) {
+            std::fclose(file);
+        } else {
+            BufferedConsoleSink::getInstance().flush();
+        }
+    }
+
+    bool isOpen() const { return file != nullptr; }
+
+    void log(const std::string& message) override {
+        log(domain::LogLevel::INFO, message);
+    }
+
+    void log(domain::LogLevel level, const std::string& message) override {
+        using domain::FormatSite;
+        using domain::LogLevel;
+        static const FormatSite sites[] = {
+            FormatSite("{}", LogLevel::TRACE), FormatSite("{}", LogLevel::DEBUG),
+            FormatSite("{}", LogLevel::INFO), FormatSite("{}", LogLevel::WARN),
+            FormatSite("{}", LogLevel::ERROR)
+        };
+        auto index = std::min<std::size_t>(static_cast<std::size_t>(level), std::size(sites) - 1);
+        domain::logFormatted(*this, sites[index], message);
+    }
+
+    // Sites registered after the format table filled up have no id to
+    // decode them by; their records are counted as dropped.
+    void logFormat(const domain::FormatSite& site, const std::byte* args, std::size_t size) override {
+        if (site.id == domain::FormatRegistry::kUnregistered) {
+            countDropped();
+            return;
+        }
+        auto timestamp = now();
+        enqueue([&](BinaryLogEntry& e) {
+            e.siteId = site.id;
+            e.size = static_cast<std::uint32_t>(size);
+            e.timestampNs = timestamp;
+            if (size <= BinaryLogEntry::kInlineSize) {
+                std::memcpy(e.args, args, size);
+            } else {
+                e.overflow.assign(args, args + size);
+            }
+        });
+    }
+
+    void flush() override {
+        RingLogger::flush();
+        if (file) {
+            std::fflush(file);
+        } else {
+            BufferedConsoleSink::getInstance().flush();
+        }
+    }
+};
+
+} // namespace infrastructure
+
+#endif
@@ -1,16 +1,20 @@
 #ifndef CONSOLE_LOGGER_HPP
 #define CONSOLE_LOGGER_HPP
 
-#include <iostream>
 #include <string>
 #include "../../domain/interfaces/ILogger.hpp"
+#include "../console/BufferedConsoleSink.hpp"
 
 namespace infrastructure {
 
 class ConsoleLogger : public domain::ILogger {
 public:
     void log(const std::string& message) override {
-        std::cout << "[LOG] " << message << std::endl;
+        BufferedConsoleSink::getInstance().writeLine("[LOG] ", message);
+    }
+
+    void log(domain::LogLevel level, const std::string& message) override {
+        BufferedConsoleSink::getInstance().writeLine(domain::logLevelTag(level), message);
     }
 };
 
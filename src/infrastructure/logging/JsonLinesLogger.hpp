@@ -0,0 +1,267 @@
+#ifndef JSON_LINES_LOGGER_HPP
+#define JSON_LINES_LOGGER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../../domain/interfaces/ILogger.hpp"
+#include "../../domain/logging/LogField.hpp"
+#include "../console/BufferedConsoleSink.hpp"
+
+namespace infrastructure {
+
+// Writes one JSON object per line:
+//   {"ts_us":1760000000000000,"level":"info","event":"ticket.created","ticket_id":"TKT-1001",...}
+// Plain messages become {"ts_us":...,"level":...,"message":"..."}.
+// Each thread encodes into its own buffer, which is handed to the output
+// in one write once it exceeds batchBytes or is older than maxDelay. A
+// background thread writes out buffers that went stale because their
+// thread stopped logging; flush() drains all of them. Buffers of exited
+// threads are reused by new ones. Concurrent loggers never contend on a
+// shared lock.
+class JsonLinesLogger : public domain::ILogger {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct ThreadBuffer {
+        std::mutex mutex;
+        std::string data;
+        Clock::time_point oldest;
+    };
+
+    // Outlives the logger while threads that used it are still running, so
+    // their exit can hand the buffer back without a dangling pointer.
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+        std::vector<ThreadBuffer*> idle;
+    };
+
+    // The buffers a thread holds, one per logger it used, released when
+    // the thread exits.
+    struct ThreadSlots {
+        struct Slot {
+            std::uint64_t owner;
+            std::weak_ptr<Registry> registry;
+            ThreadBuffer* buffer;
+        };
+        std::vector<Slot> slots;
+
+        ~ThreadSlots() {
+            for (auto& slot : slots) {
+                if (auto registry = slot.registry.lock()) {
+                    std::lock_guard<std::mutex> lock(registry->mutex);
+                    registry->idle.push_back(slot.buffer);
+                }
+            }
+        }
+    };
+
+    static inline std::atomic<std::uint64_t> instanceCount{0};
+
+    const std::uint64_t instanceId = ++instanceCount;
+    std::FILE* file = nullptr;
+    std::size_t batchBytes;
+    std::chrono::milliseconds maxDelay;
+    std::shared_ptr<Registry> registry = std::make_shared<Registry>();
+
+    std::mutex flusherMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+    std::thread flusher;
+
+    ThreadBuffer& localBuffer() {
+        thread_local std::uint64_t cachedOwner = 0;
+        thread_local ThreadBuffer* cached = nullptr;
+        if (cachedOwner == instanceId) return *cached;
+
+        thread_local ThreadSlots held;
+        ThreadBuffer* buffer = nullptr;
+        for (auto& slot : held.slots) {
+            if (slot.owner == instanceId) buffer = slot.buffer;
+        }
+        if (!buffer) {
+            std::erase_if(held.slots, [](const auto& slot) { return slot.registry.expired(); });
+            std::lock_guard<std::mutex> lock(registry->mutex);
+            if (!registry->idle.empty()) {
+                buffer = registry->idle.back();
+                registry->idle.pop_back();
+            } else {
+                registry->buffers.push_back(std::make_unique<ThreadBuffer>());
+                buffer = registry->buffers.back().get();
+                buffer->data.reserve(batchBytes * 2);
+            }
+            held.slots.push_back({instanceId, registry, buffer});
+        }
+        cachedOwner = instanceId;
+        cached = buffer;
+        return *cached;
+    }
+
+    void flushLoop() {
+        std::unique_lock<std::mutex> lock(flusherMutex);
+        while (!stopping) {
+            wake.wait_for(lock, std::max(maxDelay / 2, std::chrono::milliseconds(1)));
+            if (stopping) break;
+            lock.unlock();
+            flushStale();
+            lock.lock();
+        }
+    }
+
+    // Writes out the buffers holding records older than maxDelay.
+    void flushStale() {
+        auto now = Clock::now();
+        bool wrote = false;
+        {
+            std::lock_guard<std::mutex> lock(registry->mutex);
+            for (auto& buffer : registry->buffers) {
+                std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+                if (buffer->data.empty() || now - buffer->oldest < maxDelay) continue;
+                output(buffer->data);
+                wrote = true;
+            }
+        }
+        if (wrote && file) std::fflush(file);
+    }
+
+    void output(std::string& data) {
+        if (data.empty()) return;
+        if (file) {
+            std::fwrite(data.data(), 1, data.size(), file);
+        } else {
+            BufferedConsoleSink::getInstance().write(data);
+        }
+        data.clear();
+    }
+
+    static const char* levelName(domain::LogLevel level) {
+        switch (level) {
+            case domain::LogLevel::TRACE: return "trace";
+            case domain::LogLevel::DEBUG: return "debug";
+            case domain::LogLevel::INFO: return "info";
+            case domain::LogLevel::WARN: return "warn";
+            case domain::LogLevel::ERROR: return "error";
+            case domain::LogLevel::OFF: break;
+        }
+        return "info";
+    }
+
+    template <typename Body>
+    void append(domain::LogLevel level, Body&& body) {
+        auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        char ts[24];
+        auto end = std::to_chars(ts, ts + sizeof(ts), micros).ptr;
+
+        auto& buffer = localBuffer();
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        auto& out = buffer.data;
+        if (out.empty()) buffer.oldest = Clock::now();
+
+        out += "{\"ts_us\":";
+        out.append(ts, end);
+        out += ",\"level\":\"";
+        out += levelName(level);
+        out += '"';
+        body(out);
+        out += "}\n";
+
+        if (out.size() >= batchBytes || Clock::now() - buffer.oldest >= maxDelay) {
+            output(out);
+        }
+    }
+
+public:
+    // Writes to the console through BufferedConsoleSink.
+    explicit JsonLinesLogger(std::size_t batch = 16 * 1024,
+                             std::chrono::milliseconds delay = std::chrono::milliseconds(200))
+        : batchBytes(batch), maxDelay(delay), flusher([this] { flushLoop(); }) {}
+
+    // Appends to the file at path.
+    explicit JsonLinesLogger(const std::string& path,
+                             std::size_t batch = 16 * 1024,
+                             std::chrono::milliseconds delay = std::chrono::milliseconds(200))
+        : file(std::fopen(path.c_str(), "ab")), batchBytes(batch), maxDelay(delay),
+          flusher([this] { flushLoop(); }) {}
+
+    ~JsonLinesLogger() override {
+        {
+            std::lock_guard<std::mutex> lock(flusherMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        flusher.join();
+        flush();
+        if (file) std::fclose(file);
+    }
+
+    JsonLinesLogger(const JsonLinesLogger&) = delete;
+    JsonLinesLogger& operator=(const JsonLinesLogger&) = delete;
+
+    bool isOpen() const { return file != nullptr; }
+
+    void log(const std::string& message) override {
+        log(domain::LogLevel::INFO, message);
+    }
+
+    void log(domain::LogLevel level, const std::string& message) override {
+        append(level, [&](std::string& out) {
+            out += ",\"message\":\"";
+            domain::appendJsonEscaped(out, message);
+            out += '"';
+        });
+    }
+
+    void logFormat(const domain::FormatSite& site, const std::byte* args, std::size_t size) override {
+        thread_local std::string message;
+        message.clear();
+        domain::formatRecord(site.format, args, size, message);
+        log(site.level, message);
+    }
+
+    void logEvent(domain::LogLevel level, std::string_view event,
+                  const domain::LogField* fields, std::size_t count) override
+    {
+        append(level, [&](std::string& out) {
+            out += ",\"event\":\"";
+            domain::appendJsonEscaped(out, event);
+            out += '"';
+            for (std::size_t i = 0; i < count; ++i) {
+                out.push_back(',');
+                out.append(fields[i].jsonKey);
+                domain::appendFieldValue(out, fields[i], true);
+            }
+        });
+    }
+
+    // Writes out every thread's pending records.
+    void flush() {
+        std::lock_guard<std::mutex> lock(registry->mutex);
+        for (auto& buffer : registry->buffers) {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            output(buffer->data);
+        }
+        if (file) {
+            std::fflush(file);
+        } else {
+            BufferedConsoleSink::getInstance().flush();
+        }
+    }
+};
+
+} // namespace infrastructure
+
+#endif
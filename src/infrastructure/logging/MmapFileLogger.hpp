@@ -0,0 +1,218 @@
+#ifndef MMAP_FILE_LOGGER_HPP
+#define MMAP_FILE_LOGGER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "MmapLogFormat.hpp"
+#include "MmapLogReader.hpp"
+#include "../../domain/concurrency/RcuCell.hpp"
+#include "../../domain/interfaces/ILogger.hpp"
+
+namespace infrastructure {
+
+struct MmapRotationPolicy {
+    std::size_t segmentBytes = 64 * 1024 * 1024;
+    std::chrono::seconds maxAge = std::chrono::hours(1);
+};
+
+// One pre-sized, memory-mapped log file. Space is handed out by a single
+// fetch_add on reserved; the kernel writes dirty pages back on its own.
+class MmapSegment {
+private:
+    int fd = -1;
+    std::byte* base = nullptr;
+    std::size_t capacity = 0;
+
+public:
+    std::atomic<std::uint64_t> reserved{sizeof(mmaplog::SegmentHeader)};
+    const std::uint64_t sequence;
+    const std::int64_t createdNs;
+
+    MmapSegment(const std::string& path, std::size_t bytes,
+                std::uint64_t seq, std::int64_t nowNs)
+        : sequence(seq), createdNs(nowNs)
+    {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return;
+        if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) return;
+        void* map = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED) return;
+        base = static_cast<std::byte*>(map);
+        capacity = bytes;
+
+        mmaplog::SegmentHeader header{};
+        std::memcpy(header.magic, mmaplog::kMagic, sizeof(header.magic));
+        header.capacity = bytes;
+        header.sequence = seq;
+        header.createdNs = nowNs;
+        std::memcpy(base, &header, sizeof(header));
+    }
+
+    // Trims the unused tail so closed segments take only the space they use.
+    ~MmapSegment() {
+        if (base) {
+            auto used = std::min<std::uint64_t>(reserved.load(std::memory_order_acquire), capacity);
+            ::munmap(base, capacity);
+            (void)::ftruncate(fd, static_cast<off_t>(used));
+        }
+        if (fd >= 0) ::close(fd);
+    }
+
+    MmapSegment(const MmapSegment&) = delete;
+    MmapSegment& operator=(const MmapSegment&) = delete;
+
+    bool isOpen() const { return base != nullptr; }
+    std::size_t size() const { return capacity; }
+
+    // Returns false if the record does not fit; the segment is then full.
+    bool append(std::int64_t timestampNs, std::string_view prefix, std::string_view text) {
+        auto length = static_cast<std::uint32_t>(prefix.size() + text.size());
+        std::size_t bytes = mmaplog::recordSize(length);
+        auto offset = reserved.fetch_add(bytes, std::memory_order_relaxed);
+        if (offset + bytes > capacity) return false;
+
+        // The length goes in first, so a reader can step over this record
+        // even if the writer never finishes it
+        std::byte* record = base + offset;
+        auto* header = reinterpret_cast<mmaplog::RecordHeader*>(record);
+        std::atomic_ref<std::uint32_t>(header->length).store(length, std::memory_order_release);
+
+        char* body = reinterpret_cast<char*>(record + sizeof(mmaplog::RecordHeader));
+        std::memcpy(body, prefix.data(), prefix.size());
+        std::memcpy(body + prefix.size(), text.data(), text.size());
+        header->timestampNs = timestampNs;
+        std::atomic_ref<std::uint32_t>(header->checksum)
+            .store(mmaplog::checksum(timestampNs, body, length), std::memory_order_release);
+        return true;
+    }
+
+    void sync() {
+        if (base) ::msync(base, capacity, MS_SYNC);
+    }
+};
+
+// ILogger that appends records to memory-mapped segment files
+// <path>.000001, <path>.000002, ... Threads write concurrently without a
+// lock; a new segment is started when the current one is full or older than
+// the policy's maxAge. Read the files back with MmapLogReader or
+// tools/mmap_log_reader.
+class MmapFileLogger : public domain::ILogger {
+private:
+    using Segment = std::shared_ptr<MmapSegment>;
+
+    std::string basePath;
+    MmapRotationPolicy policy;
+    domain::RcuCell<Segment> current;
+    std::uint64_t nextSequence = 1;  // guarded by RcuCell::update
+    std::atomic<std::uint64_t> dropped{0};
+
+    static std::int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    // Replaces full, unless another thread already did. Rotation publishes
+    // the new segment first; the old one is unmapped once no writer can
+    // still be inside it.
+    void rotate(const MmapSegment* full, std::int64_t timestampNs) {
+        current.update([&](Segment& segment) {
+            if (segment.get() != full) return false;
+            auto sequence = nextSequence;
+            auto next = std::make_shared<MmapSegment>(
+                mmaplog::segmentPath(basePath, sequence), policy.segmentBytes,
+                sequence, timestampNs);
+            if (!next->isOpen()) return false;
+            nextSequence = sequence + 1;
+            segment = next;
+            return true;
+        });
+    }
+
+    void write(domain::LogLevel level, std::string_view message) {
+        std::string_view tag = domain::logLevelTag(level);
+        std::size_t limit = policy.segmentBytes - sizeof(mmaplog::SegmentHeader)
+                          - sizeof(mmaplog::RecordHeader) - tag.size();
+        message = message.substr(0, std::min(message.size(), limit));
+
+        auto timestamp = now();
+        auto ageLimit = std::chrono::duration_cast<std::chrono::nanoseconds>(policy.maxAge).count();
+        for (int attempt = 0; attempt < 3; ++attempt) {
+            const MmapSegment* full;
+            {
+                auto guard = current.read();
+                MmapSegment* segment = guard->get();
+                if (!segment) break;
+                if (timestamp - segment->createdNs < ageLimit &&
+                    segment->append(timestamp, tag, message)) {
+                    return;
+                }
+                full = segment;
+            }
+            rotate(full, timestamp);
+        }
+        dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+public:
+    // Continues numbering after any segments already present for path.
+    explicit MmapFileLogger(const std::string& path,
+                            MmapRotationPolicy rotation = MmapRotationPolicy())
+        : basePath(path), policy(rotation)
+    {
+        // Aligned, so a message truncated to fit an empty segment does fit
+        policy.segmentBytes = std::max<std::size_t>(policy.segmentBytes, 4096)
+                            & ~(mmaplog::kAlignment - 1);
+        auto existing = MmapLogReader::listSegments(basePath);
+        if (!existing.empty()) {
+            const auto& last = existing.back();
+            nextSequence = std::strtoull(last.c_str() + last.rfind('.') + 1, nullptr, 10) + 1;
+        }
+        rotate(nullptr, now());
+    }
+
+    bool isOpen() {
+        auto guard = current.read();
+        return *guard != nullptr;
+    }
+
+    void log(const std::string& message) override {
+        write(domain::LogLevel::INFO, message);
+    }
+
+    void log(domain::LogLevel level, const std::string& message) override {
+        write(level, message);
+    }
+
+    void logFormat(const domain::FormatSite& site, const std::byte* args, std::size_t size) override {
+        thread_local std::string message;
+        message.clear();
+        domain::formatRecord(site.format, args, size, message);
+        write(site.level, message);
+    }
+
+    // Forces the current segment to disk (normally left to the kernel).
+    void flush() {
+        auto guard = current.read();
+        if (*guard) (*guard)->sync();
+    }
+
+    // Records lost because a segment could not be created.
+    std::uint64_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+};
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef MMAP_LOG_FORMAT_HPP
+#define MMAP_LOG_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace infrastructure {
+
+// Layout of the segment files written by MmapFileLogger. A segment is a
+// pre-sized file; unwritten space reads as zeros.
+//   header : SegmentHeader (64 bytes)
+//   record : RecordHeader (16 bytes), length bytes of text, zero padding
+//            up to the next multiple of 8
+// The writer stores length right after reserving the record and the
+// checksum last; a record is complete once its checksum is stored.
+// length == 0 marks unwritten space, normally the end of the written area.
+namespace mmaplog {
+
+constexpr char kMagic[8] = {'C', 'P', 'M', 'L', 'O', 'G', '0', '1'};
+constexpr std::size_t kAlignment = 8;
+
+struct SegmentHeader {
+    char magic[8];
+    std::uint64_t capacity;
+    std::uint64_t sequence;
+    std::int64_t createdNs;
+    std::byte reserved[32];
+};
+static_assert(sizeof(SegmentHeader) == 64);
+
+struct RecordHeader {
+    std::uint32_t length;
+    std::uint32_t checksum;
+    std::int64_t timestampNs;
+};
+static_assert(sizeof(RecordHeader) == 16);
+
+inline std::size_t recordSize(std::size_t length) {
+    return (sizeof(RecordHeader) + length + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+// FNV-1a over the timestamp and text, forced non-zero so that 0 always
+// means "not committed".
+inline std::uint32_t checksum(std::int64_t timestampNs, const char* text, std::size_t length) {
+    std::uint32_t hash = 2166136261u;
+    auto mix = [&](unsigned char byte) {
+        hash ^= byte;
+        hash *= 16777619u;
+    };
+    for (std::size_t i = 0; i < sizeof(timestampNs); ++i) {
+        mix(static_cast<unsigned char>(static_cast<std::uint64_t>(timestampNs) >> (8 * i)));
+    }
+    for (std::size_t i = 0; i < length; ++i) {
+        mix(static_cast<unsigned char>(text[i]));
+    }
+    return hash ? hash : 1u;
+}
+
+// "<base>.000042"
+inline std::string segmentPath(const std::string& base, std::uint64_t sequence) {
+    char suffix[24];
+    std::snprintf(suffix, sizeof(suffix), ".%06llu", static_cast<unsigned long long>(sequence));
+    return base + suffix;
+}
+
+} // namespace mmaplog
+
+} // namespace infrastructure
+
+#endif
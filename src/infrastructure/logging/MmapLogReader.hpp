@@ -0,0 +1,169 @@
+#ifndef MMAP_LOG_READER_HPP
+#define MMAP_LOG_READER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MmapLogFormat.hpp"
+
+namespace infrastructure {
+
+struct MmapLogRecord {
+    std::size_t offset;
+    std::int64_t timestampNs;
+    std::string_view text;
+};
+
+struct MmapLogScan {
+    bool valid = false;          // file opened and header recognised
+    std::uint64_t sequence = 0;
+    std::size_t records = 0;     // complete records
+    std::size_t torn = 0;        // reserved but never committed (skipped)
+    std::size_t gaps = 0;        // zero headers with committed records after them
+    std::size_t endOffset = 0;   // end of the last complete record
+    bool corrupt = false;        // skipped an impossible record header
+};
+
+// Crash-recovery reader for MmapFileLogger segments. Walks the records in
+// file order and skips ones whose writer died before committing them. A
+// zero length is either the end of the written area or a writer that died
+// right after reserving; the reader then looks for the next committed
+// record and only stops when there is none.
+class MmapLogReader {
+private:
+    int fd = -1;
+    const std::byte* data = nullptr;
+    std::size_t size = 0;
+
+public:
+    explicit MmapLogReader(const std::string& path) {
+        fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(mmaplog::SegmentHeader))) {
+            return;
+        }
+        void* map = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED) return;
+        data = static_cast<const std::byte*>(map);
+        size = static_cast<std::size_t>(st.st_size);
+    }
+
+    ~MmapLogReader() {
+        if (data) ::munmap(const_cast<std::byte*>(data), size);
+        if (fd >= 0) ::close(fd);
+    }
+
+    MmapLogReader(const MmapLogReader&) = delete;
+    MmapLogReader& operator=(const MmapLogReader&) = delete;
+
+    bool isOpen() const { return data != nullptr; }
+
+    // Offset of the next committed record at or after from, or limit.
+    std::size_t findCommitted(std::size_t from, std::size_t limit) const {
+        for (std::size_t offset = from; offset + sizeof(mmaplog::RecordHeader) <= limit;
+             offset += mmaplog::kAlignment) {
+            mmaplog::RecordHeader record;
+            std::memcpy(&record, data + offset, sizeof(record));
+            if (record.length == 0 || record.checksum == 0) continue;
+            std::size_t next = offset + mmaplog::recordSize(record.length);
+            if (next > limit || next <= offset) continue;
+            const char* text = reinterpret_cast<const char*>(data + offset + sizeof(record));
+            if (record.checksum == mmaplog::checksum(record.timestampNs, text, record.length)) {
+                return offset;
+            }
+        }
+        return limit;
+    }
+
+    // Calls visit(const MmapLogRecord&) for every complete record.
+    template <typename Visit>
+    MmapLogScan scan(Visit&& visit) const {
+        MmapLogScan result;
+        if (!data) return result;
+
+        mmaplog::SegmentHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        if (std::memcmp(header.magic, mmaplog::kMagic, sizeof(mmaplog::kMagic)) != 0) {
+            return result;
+        }
+        result.valid = true;
+        result.sequence = header.sequence;
+
+        std::size_t limit = std::min<std::size_t>(size, header.capacity);
+        std::size_t offset = sizeof(header);
+        result.endOffset = offset;
+        while (offset + sizeof(mmaplog::RecordHeader) <= limit) {
+            mmaplog::RecordHeader record;
+            std::memcpy(&record, data + offset, sizeof(record));
+            if (record.length == 0) {
+                std::size_t resume = findCommitted(offset + mmaplog::kAlignment, limit);
+                if (resume == limit) break;
+                ++result.gaps;
+                offset = resume;
+                continue;
+            }
+
+            std::size_t next = offset + mmaplog::recordSize(record.length);
+            if (next > limit || next <= offset) {
+                result.corrupt = true;
+                std::size_t resume = findCommitted(offset + mmaplog::kAlignment, limit);
+                if (resume == limit) break;
+                offset = resume;
+                continue;
+            }
+
+            const char* text = reinterpret_cast<const char*>(data + offset + sizeof(record));
+            if (record.checksum != 0 &&
+                record.checksum == mmaplog::checksum(record.timestampNs, text, record.length)) {
+                visit(MmapLogRecord{offset, record.timestampNs,
+                                    std::string_view(text, record.length)});
+                ++result.records;
+                result.endOffset = next;
+            } else {
+                ++result.torn;
+            }
+            offset = next;
+        }
+        return result;
+    }
+
+    MmapLogScan scan() const {
+        return scan([](const MmapLogRecord&) {});
+    }
+
+    // Segment files of base in sequence order.
+    static std::vector<std::string> listSegments(const std::string& base) {
+        namespace fs = std::filesystem;
+        fs::path basePath(base);
+        fs::path dir = basePath.has_parent_path() ? basePath.parent_path() : fs::path(".");
+        std::string prefix = basePath.filename().string() + ".";
+
+        std::vector<std::string> segments;
+        std::error_code ec;
+        for (const auto& entry : fs::directory_iterator(dir, ec)) {
+            std::string name = entry.path().filename().string();
+            if (name.size() > prefix.size() && name.compare(0, prefix.size(), prefix) == 0 &&
+                name.find_first_not_of("0123456789", prefix.size()) == std::string::npos) {
+                segments.push_back(entry.path().string());
+            }
+        }
+        std::sort(segments.begin(), segments.end());
+        return segments;
+    }
+};
+
+} // namespace infrastructure
+
+#endif
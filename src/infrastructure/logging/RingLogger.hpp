@@ -0,0 +1,138 @@
+#ifndef RING_LOGGER_HPP
+#define RING_LOGGER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "../../domain/concurrency/MpscRingBuffer.hpp"
+#include "../../domain/interfaces/ILogger.hpp"
+
+namespace infrastructure {
+
+enum class OverflowPolicy {
+    DROP,   // discard the message and count it
+    BLOCK   // wait for the writer thread to free a slot
+};
+
+// Shared machinery of the background loggers: producers fill a slot of a
+// lock-free ring, one writer thread drains it and emits batches. Derived
+// classes decide how a slot is filled, formatted and written.
+template <typename Entry>
+class RingLogger : public domain::ILogger {
+private:
+    domain::MpscRingBuffer<Entry> ring;
+    OverflowPolicy policy;
+    std::atomic<std::uint64_t> accepted{0};
+    std::atomic<std::uint64_t> written{0};
+    std::atomic<std::uint64_t> dropped{0};
+    std::uint64_t droppedReported = 0;
+    std::atomic<bool> running{false};
+    std::atomic<bool> writerIdle{false};
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    std::thread writer;
+
+    void completeBatch(std::uint64_t count) {
+        auto lost = dropped.load(std::memory_order_relaxed);
+        if (lost != droppedReported) {
+            onDropped(lost - droppedReported);
+            droppedReported = lost;
+        }
+        writeBatch();
+        written.fetch_add(count, std::memory_order_release);
+    }
+
+    void drain() {
+        std::uint64_t count = 0;
+        while (ring.tryPop([&](Entry& e) { consume(e); })) {
+            ++count;
+            if (batchFull()) {
+                completeBatch(count);
+                count = 0;
+            }
+        }
+        completeBatch(count);
+    }
+
+    void writerLoop() {
+        while (running.load(std::memory_order_acquire)) {
+            drain();
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            writerIdle.store(true, std::memory_order_seq_cst);
+            if (ring.empty()) {
+                wake.wait_for(lock, std::chrono::milliseconds(5));
+            }
+            writerIdle.store(false, std::memory_order_relaxed);
+        }
+        drain();
+    }
+
+protected:
+    RingLogger(std::size_t capacity, OverflowPolicy overflow)
+        : ring(capacity), policy(overflow) {}
+
+    // Derived constructors call start() once their own members are ready,
+    // and their destructors call stop() before those members go away.
+    void start() {
+        running.store(true, std::memory_order_release);
+        writer = std::thread([this] { writerLoop(); });
+    }
+
+    void stop() {
+        if (!writer.joinable()) return;
+        running.store(false, std::memory_order_release);
+        wake.notify_one();
+        writer.join();
+    }
+
+    template <typename Fill>
+    void enqueue(Fill&& fill) {
+        while (!ring.tryPush(fill)) {
+            if (policy == OverflowPolicy::DROP) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            wake.notify_one();
+            std::this_thread::yield();
+        }
+        accepted.fetch_add(1, std::memory_order_relaxed);
+        if (writerIdle.load(std::memory_order_seq_cst)) {
+            wake.notify_one();
+        }
+    }
+
+    // For records a derived class rejects before enqueueing them; they are
+    // reported through onDropped() like ring overflows.
+    void countDropped() {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Writer thread hooks.
+    virtual void consume(Entry& entry) = 0;
+    virtual bool batchFull() const = 0;
+    virtual void writeBatch() = 0;
+    virtual void onDropped(std::uint64_t count) = 0;
+
+public:
+    RingLogger(const RingLogger&) = delete;
+    RingLogger& operator=(const RingLogger&) = delete;
+
+    // Blocks until every message accepted so far has been written.
+    virtual void flush() {
+        auto target = accepted.load(std::memory_order_relaxed);
+        wake.notify_one();
+        while (written.load(std::memory_order_acquire) < target) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::uint64_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+};
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef ALLOCATION_HOOKS_HPP
+#define ALLOCATION_HOOKS_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "../../domain/metrics/AllocationTracker.hpp"
+
+// Replaces the global operator new/delete with versions that count every
+// allocation in domain::allocation::threadStats, which turns on allocation
+// accounting (AllocationScope, service allocation metrics). Opt-in: include
+// from exactly one translation unit of the program, e.g. main.cpp built
+// with -DTRACK_ALLOCATIONS.
+
+namespace infrastructure {
+
+inline void* trackedAlloc(std::size_t size, std::size_t alignment) {
+    domain::allocation::onAllocate(size);
+    if (size == 0) size = 1;
+    void* p = alignment > alignof(std::max_align_t)
+        ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)
+        : std::malloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+static const bool allocationHooksInstalled = [] {
+    domain::allocation::hooksInstalled.store(true, std::memory_order_relaxed);
+    return true;
+}();
+
+} // namespace infrastructure
+
+void* operator new(std::size_t size) { return infrastructure::trackedAlloc(size, 0); }
+void* operator new[](std::size_t size) { return infrastructure::trackedAlloc(size, 0); }
+void* operator new(std::size_t size, std::align_val_t a) {
+    return infrastructure::trackedAlloc(size, static_cast<std::size_t>(a));
+}
+void* operator new[](std::size_t size, std::align_val_t a) {
+    return infrastructure::trackedAlloc(size, static_cast<std::size_t>(a));
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+#endif
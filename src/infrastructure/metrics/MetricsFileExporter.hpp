@@ -0,0 +1,80 @@
+#ifndef METRICS_FILE_EXPORTER_HPP
+#define METRICS_FILE_EXPORTER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "PrometheusFormat.hpp"
+
+namespace infrastructure {
+
+// Rewrites a Prometheus text file with the MetricsRegistry contents every
+// interval, for node_exporter's textfile collector or a sidecar. Each
+// snapshot goes to <path>.tmp and is renamed over path, so readers never
+// see a partial file. A last snapshot is written on destruction.
+class MetricsFileExporter {
+private:
+    std::string path;
+    std::chrono::milliseconds interval;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    bool stopping = false;
+    std::thread writer;
+    std::string text;
+
+    bool writeNow() {
+        text.clear();
+        prometheus::append(text, domain::MetricsRegistry::getInstance().collect());
+        std::string temp = path + ".tmp";
+        std::FILE* f = std::fopen(temp.c_str(), "w");
+        if (!f) return false;
+        bool ok = std::fwrite(text.data(), 1, text.size(), f) == text.size();
+        ok = std::fclose(f) == 0 && ok;
+        return ok && std::rename(temp.c_str(), path.c_str()) == 0;
+    }
+
+    void writerLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            if (!stopping) wakeup.wait_for(lock, interval);
+            bool last = stopping;
+            lock.unlock();
+            writeNow();
+            if (last) return;
+            lock.lock();
+        }
+    }
+
+public:
+    MetricsFileExporter(std::string file, std::chrono::milliseconds every)
+        : path(std::move(file)), interval(every) {}
+
+    ~MetricsFileExporter() {
+        if (!writer.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeup.notify_one();
+        writer.join();
+    }
+
+    MetricsFileExporter(const MetricsFileExporter&) = delete;
+    MetricsFileExporter& operator=(const MetricsFileExporter&) = delete;
+
+    // Writes the first snapshot and starts the background thread; false if
+    // the file cannot be written.
+    bool start() {
+        if (!writeNow()) return false;
+        writer = std::thread([this] { writerLoop(); });
+        return true;
+    }
+};
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef PROMETHEUS_FORMAT_HPP
+#define PROMETHEUS_FORMAT_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../domain/metrics/MetricsRegistry.hpp"
+
+namespace infrastructure {
+
+namespace prometheus {
+
+inline constexpr std::string_view kContentType = "text/plain; version=0.0.4";
+
+// Histogram bucket bounds, 1 us to 10 s.
+struct BucketBound {
+    std::uint64_t ns;
+    const char* le;
+};
+
+inline constexpr BucketBound kBucketBounds[] = {
+    {1'000, "0.000001"}, {2'500, "0.0000025"}, {5'000, "0.000005"},
+    {10'000, "0.00001"}, {25'000, "0.000025"}, {50'000, "0.00005"},
+    {100'000, "0.0001"}, {250'000, "0.00025"}, {500'000, "0.0005"},
+    {1'000'000, "0.001"}, {2'500'000, "0.0025"}, {5'000'000, "0.005"},
+    {10'000'000, "0.01"}, {25'000'000, "0.025"}, {50'000'000, "0.05"},
+    {100'000'000, "0.1"}, {250'000'000, "0.25"}, {500'000'000, "0.5"},
+    {1'000'000'000, "1"}, {2'500'000'000, "2.5"}, {5'000'000'000, "5"},
+    {10'000'000'000, "10"}};
+
+inline void appendNumber(std::string& out, double value) {
+    char buf[32];
+    auto end = std::to_chars(buf, buf + sizeof(buf), value).ptr;
+    out.append(buf, end);
+}
+
+inline void appendSeries(std::string& out, std::string_view name, std::string_view suffix,
+                         std::string_view labels, std::string_view extraLabel, double value)
+{
+    out += name;
+    out += suffix;
+    if (!labels.empty() || !extraLabel.empty()) {
+        out += '{';
+        out += labels;
+        if (!labels.empty() && !extraLabel.empty()) out += ',';
+        out += extraLabel;
+        out += '}';
+    }
+    out += ' ';
+    appendNumber(out, value);
+    out += '\n';
+}
+
+// Cumulative buckets in seconds. A LatencyHistogram bucket is counted under
+// the first bound at or above its upper edge, so counts are within the
+// histogram's ~3% precision.
+inline void appendHistogram(std::string& out, const domain::MetricSample& s) {
+    const auto& h = s.histogram;
+    std::size_t bucket = 0;
+    std::uint64_t cumulative = 0;
+    std::string le;
+    for (auto& bound : kBucketBounds) {
+        while (bucket < h.buckets.size() &&
+               domain::LatencyHistogram::bucketUpperBound(bucket) <= bound.ns) {
+            cumulative += h.buckets[bucket++];
+        }
+        le.assign("le=\"");
+        le += bound.le;
+        le += '"';
+        appendSeries(out, s.name, "_bucket", s.labels, le, static_cast<double>(cumulative));
+    }
+    appendSeries(out, s.name, "_bucket", s.labels, "le=\"+Inf\"", static_cast<double>(h.count));
+    appendSeries(out, s.name, "_sum", s.labels, {}, static_cast<double>(h.sum) / 1e9);
+    appendSeries(out, s.name, "_count", s.labels, {}, static_cast<double>(h.count));
+}
+
+// Text exposition format 0.0.4. samples must be grouped by name, as
+// MetricsRegistry::collect() returns them.
+inline void append(std::string& out, const std::vector<domain::MetricSample>& samples) {
+    std::string_view previous;
+    for (auto& s : samples) {
+        if (s.name != previous) {
+            out += "# HELP "; out += s.name; out += ' '; out += s.help; out += '\n';
+            out += "# TYPE "; out += s.name;
+            out += s.type == domain::MetricType::COUNTER ? " counter\n"
+                 : s.type == domain::MetricType::GAUGE ? " gauge\n" : " histogram\n";
+            previous = s.name;
+        }
+        if (s.type == domain::MetricType::HISTOGRAM) appendHistogram(out, s);
+        else appendSeries(out, s.name, {}, s.labels, {}, s.value);
+    }
+}
+
+} // namespace prometheus
+
+} // namespace infrastructure
+
+#endif
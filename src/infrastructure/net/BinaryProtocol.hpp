@@ -0,0 +1,160 @@
+#ifndef BINARY_PROTOCOL_HPP
+#define BINARY_PROTOCOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace infrastructure {
+
+// Binary request/response framing of `app --serve ... --protocol bin`.
+// All integers are little-endian and fields are unaligned:
+//   frame  : u32 length of the rest of the frame, u8 version, u8 opcode,
+//            u16 record count, record count x record
+//   str    : u16 length, length bytes
+// Request records by opcode:
+//   CREATE_CUSTOMER : str name, str email, str phone, u8 type
+//   CREATE_TICKET   : str customer id, str description, u8 priority, u8 category
+//   UPDATE_STATUS   : str ticket id, u8 status
+// The response to a frame has the same version, opcode and count, with
+// one record per request record, in order:
+//   result : u8 Result, str id (the created id, empty otherwise)
+// A frame that cannot be decoded is answered with a BAD_FRAME frame of no
+// records, after which the connection is closed.
+// Enum bytes are the numeric codes of domain/models/Enums.hpp.
+namespace wire {
+
+constexpr std::uint8_t kVersion = 1;
+constexpr std::size_t kHeaderBytes = 8;
+constexpr std::size_t kMaxFrameBytes = 1 << 20;
+
+enum class Opcode : std::uint8_t {
+    BAD_FRAME = 0,
+    CREATE_CUSTOMER = 1,
+    CREATE_TICKET = 2,
+    UPDATE_STATUS = 3
+};
+
+enum class Result : std::uint8_t { OK = 0, NOT_FOUND = 1, INVALID = 2 };
+
+enum class FrameStatus { COMPLETE, INCOMPLETE, BAD };
+
+struct FrameHeader {
+    std::uint8_t version = 0;
+    Opcode opcode = Opcode::BAD_FRAME;
+    std::uint16_t count = 0;
+    std::string_view records;  // view into the input, valid until it is consumed
+};
+
+template <typename T>
+inline T load(const char* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Splits the frame at the front of input. On COMPLETE, consumed is the
+// size of the whole frame.
+inline FrameStatus decodeFrame(std::string_view input, FrameHeader& frame, std::size_t& consumed) {
+    if (input.size() < 4) return FrameStatus::INCOMPLETE;
+    std::uint32_t length = load<std::uint32_t>(input.data());
+    if (length < kHeaderBytes - 4 || length > kMaxFrameBytes) return FrameStatus::BAD;
+    if (input.size() - 4 < length) return FrameStatus::INCOMPLETE;
+    frame.version = static_cast<std::uint8_t>(input[4]);
+    frame.opcode = static_cast<Opcode>(input[5]);
+    frame.count = load<std::uint16_t>(input.data() + 6);
+    frame.records = input.substr(kHeaderBytes, length - (kHeaderBytes - 4));
+    consumed = 4 + length;
+    return FrameStatus::COMPLETE;
+}
+
+// Bounds-checked reads over the records of a frame. Past the end, reads
+// return zero or empty and ok() turns false.
+class FrameReader {
+private:
+    const char* p;
+    const char* end;
+    bool good = true;
+
+    bool take(std::size_t n) {
+        if (static_cast<std::size_t>(end - p) < n) {
+            good = false;
+            p = end;
+            return false;
+        }
+        return true;
+    }
+
+public:
+    explicit FrameReader(std::string_view records)
+        : p(records.data()), end(records.data() + records.size()) {}
+
+    std::uint8_t u8() {
+        if (!take(1)) return 0;
+        return static_cast<std::uint8_t>(*p++);
+    }
+
+    std::uint16_t u16() {
+        if (!take(2)) return 0;
+        auto value = load<std::uint16_t>(p);
+        p += 2;
+        return value;
+    }
+
+    std::string_view str() {
+        std::size_t n = u16();
+        if (!take(n)) return {};
+        std::string_view value(p, n);
+        p += n;
+        return value;
+    }
+
+    bool ok() const { return good; }
+    bool atEnd() const { return p == end; }
+};
+
+// Appends one frame to out; finish() fills in the length.
+class FrameWriter {
+private:
+    std::string& out;
+    std::size_t start;
+
+    template <typename T>
+    void put(T value) {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        out.append(bytes, sizeof(T));
+    }
+
+public:
+    FrameWriter(std::string& buffer, Opcode opcode, std::uint16_t count,
+                std::size_t expectedBytes = 0)
+        : out(buffer), start(buffer.size())
+    {
+        out.reserve(start + kHeaderBytes + expectedBytes);
+        put<std::uint32_t>(0);
+        put<std::uint8_t>(kVersion);
+        put(static_cast<std::uint8_t>(opcode));
+        put(count);
+    }
+
+    void u8(std::uint8_t value) { put(value); }
+
+    void str(std::string_view text) {
+        put(static_cast<std::uint16_t>(text.size()));
+        out.append(text.data(), text.size());
+    }
+
+    void finish() {
+        auto length = static_cast<std::uint32_t>(out.size() - start - 4);
+        std::memcpy(&out[start], &length, sizeof(length));
+    }
+};
+
+} // namespace wire
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,339 @@
+#ifndef EPOLL_SERVER_HPP
+#define EPOLL_SERVER_HPP
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "Socket.hpp"
+#include "../async/WorkerPool.hpp"
+#include "../../domain/interfaces/IRequestHandler.hpp"
+
+namespace infrastructure {
+
+struct ServerStats {
+    std::uint64_t accepted = 0;
+    std::uint64_t jobs = 0;
+    std::uint64_t bytesIn = 0;
+    std::uint64_t bytesOut = 0;
+};
+
+// Non-blocking socket server. One thread runs run(): it accepts, reads and
+// writes through epoll. Request bytes are handed to the worker pool, where
+// the IRequestHandler parses and executes them; the responses come back
+// through an eventfd and are written by the loop.
+//
+// A connection has at most one job in flight, which keeps its responses in
+// request order. Everything that arrived by the time a job starts goes
+// into it, so pipelined requests are executed as one batch.
+class EpollServer {
+private:
+    static constexpr std::size_t kReadChunk = 64 * 1024;
+    static constexpr std::size_t kMaxBuffered = 4 << 20;   // per direction, per connection
+    static constexpr int kMaxEvents = 256;
+
+    struct Connection {
+        int fd;
+        std::uint64_t id;
+        std::string in;            // received, not yet given to a worker
+        std::string out;           // responses not yet written
+        std::size_t outOffset = 0;
+        std::uint32_t events = 0;  // registered epoll interest
+        bool busy = false;         // a worker holds part of the input
+        bool fresh = false;        // input arrived since the last job
+        bool peerClosed = false;
+        bool closeAfterWrite = false;
+        bool dead = false;         // closed; the fd stays open until the job returns
+
+        std::size_t pendingOut() const { return out.size() - outOffset; }
+    };
+
+    struct Completion {
+        int fd;
+        std::uint64_t id;
+        std::string input;
+        std::string output;
+        domain::HandleResult result;
+    };
+
+    domain::IRequestHandler& handler;
+    int epollFd = -1;
+    int wakeFd = -1;
+    int listenFd = -1;
+    bool tcp = true;
+    std::unordered_map<int, std::unique_ptr<Connection>> connections;
+    std::uint64_t nextId = 1;
+    std::atomic<bool> stopping{false};
+
+    std::mutex completionMutex;
+    std::vector<Completion> completions;
+
+    std::atomic<std::uint64_t> accepted{0};
+    std::atomic<std::uint64_t> jobs{0};
+    std::atomic<std::uint64_t> bytesIn{0};
+    std::atomic<std::uint64_t> bytesOut{0};
+
+    std::unique_ptr<WorkerPool> workers;
+
+    void wake() {
+        std::uint64_t one = 1;
+        ssize_t n = ::write(wakeFd, &one, sizeof(one));
+        (void)n;
+    }
+
+    void setInterest(Connection& c) {
+        std::uint32_t wanted = c.peerClosed ? 0u : static_cast<std::uint32_t>(EPOLLRDHUP);
+        if (!c.peerClosed && !c.closeAfterWrite &&
+            c.in.size() < kMaxBuffered && c.pendingOut() < kMaxBuffered) {
+            wanted |= EPOLLIN;
+        }
+        if (c.pendingOut() > 0) wanted |= EPOLLOUT;
+        if (wanted == c.events) return;
+        epoll_event ev{};
+        ev.events = wanted;
+        ev.data.fd = c.fd;
+        ::epoll_ctl(epollFd, EPOLL_CTL_MOD, c.fd, &ev);
+        c.events = wanted;
+    }
+
+    // The descriptor is released by reap() once no job refers to it.
+    void close(Connection& c) {
+        if (c.dead) return;
+        c.dead = true;
+        ::epoll_ctl(epollFd, EPOLL_CTL_DEL, c.fd, nullptr);
+    }
+
+    void reap(Connection& c) {
+        if (!c.dead || c.busy) return;
+        int fd = c.fd;
+        ::close(fd);
+        connections.erase(fd);
+    }
+
+    void acceptAll() {
+        for (;;) {
+            int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) {
+                if (errno == EINTR) continue;
+                return;  // EAGAIN, or out of descriptors until one closes
+            }
+            if (tcp) net::setNoDelay(fd);
+            auto c = std::make_unique<Connection>();
+            c->fd = fd;
+            c->id = nextId++;
+            c->events = EPOLLIN | EPOLLRDHUP;
+            epoll_event ev{};
+            ev.events = c->events;
+            ev.data.fd = fd;
+            if (::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+                ::close(fd);
+                continue;
+            }
+            connections[fd] = std::move(c);
+            accepted.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void readAvailable(Connection& c) {
+        while (c.in.size() < kMaxBuffered) {
+            std::size_t used = c.in.size();
+            c.in.resize(used + kReadChunk);
+            ssize_t n = ::read(c.fd, c.in.data() + used, kReadChunk);
+            c.in.resize(used + (n > 0 ? static_cast<std::size_t>(n) : 0));
+            if (n > 0) {
+                c.fresh = true;
+                bytesIn.fetch_add(static_cast<std::uint64_t>(n), std::memory_order_relaxed);
+                if (static_cast<std::size_t>(n) < kReadChunk) return;
+                continue;
+            }
+            if (n == 0) {
+                c.peerClosed = true;
+                return;
+            }
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) close(c);
+            return;
+        }
+    }
+
+    void writePending(Connection& c) {
+        while (c.pendingOut() > 0) {
+            ssize_t n = ::send(c.fd, c.out.data() + c.outOffset, c.pendingOut(), MSG_NOSIGNAL);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                if (errno != EAGAIN && errno != EWOULDBLOCK) close(c);
+                return;
+            }
+            c.outOffset += static_cast<std::size_t>(n);
+            bytesOut.fetch_add(static_cast<std::uint64_t>(n), std::memory_order_relaxed);
+        }
+        c.out.clear();
+        c.outOffset = 0;
+    }
+
+    void dispatch(Connection& c) {
+        if (c.busy || c.dead || !c.fresh || c.in.empty() || c.closeAfterWrite) return;
+        c.busy = true;
+        c.fresh = false;
+        jobs.fetch_add(1, std::memory_order_relaxed);
+        workers->submit([this, fd = c.fd, id = c.id, input = std::move(c.in)]() mutable {
+            Completion done{fd, id, std::move(input), {}, {}};
+            done.result = handler.handle(done.input, done.output);
+            {
+                std::lock_guard<std::mutex> lock(completionMutex);
+                completions.push_back(std::move(done));
+            }
+            wake();
+        });
+        c.in = std::string();
+    }
+
+    // Moves a connection on after I/O or a finished job: starts the next
+    // job, closes when done, and updates the epoll interest.
+    void advance(Connection& c) {
+        if (c.dead) return;
+        dispatch(c);
+        bool drained = c.pendingOut() == 0;
+        if (drained && !c.busy && (c.closeAfterWrite || (c.peerClosed && !c.fresh))) {
+            close(c);
+            return;
+        }
+        setInterest(c);
+    }
+
+    void finishJobs() {
+        std::vector<Completion> done;
+        {
+            std::lock_guard<std::mutex> lock(completionMutex);
+            done.swap(completions);
+        }
+        for (auto& job : done) {
+            auto it = connections.find(job.fd);
+            if (it == connections.end() || it->second->id != job.id) continue;
+            Connection& c = *it->second;
+            c.busy = false;
+            if (c.dead) {
+                reap(c);
+                continue;
+            }
+
+            // Put an incomplete trailing request back in front of newer bytes
+            if (job.result.consumed < job.input.size()) {
+                job.input.erase(0, job.result.consumed);
+                job.input += c.in;
+                c.in = std::move(job.input);
+                if (c.in.size() >= kMaxBuffered) job.result.close = true;
+            } else if (c.in.empty()) {
+                job.input.clear();
+                c.in = std::move(job.input);  // keep the capacity
+            }
+
+            if (c.pendingOut() == 0) {
+                c.out = std::move(job.output);
+                c.outOffset = 0;
+            } else {
+                c.out += job.output;
+            }
+            if (job.result.close) c.closeAfterWrite = true;
+
+            writePending(c);
+            advance(c);
+            reap(c);
+        }
+    }
+
+public:
+    explicit EpollServer(domain::IRequestHandler& requestHandler, std::size_t workerThreads)
+        : handler(requestHandler), workers(std::make_unique<WorkerPool>(workerThreads))
+    {
+        epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+        wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = wakeFd;
+        ::epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &ev);
+    }
+
+    ~EpollServer() {
+        workers.reset();  // finish running jobs while the eventfd is still open
+        for (auto& entry : connections) ::close(entry.first);
+        if (listenFd >= 0) ::close(listenFd);
+        ::close(wakeFd);
+        ::close(epollFd);
+    }
+
+    EpollServer(const EpollServer&) = delete;
+    EpollServer& operator=(const EpollServer&) = delete;
+
+    bool listen(const Endpoint& endpoint) {
+        listenFd = net::listenOn(endpoint);
+        if (listenFd < 0) return false;
+        tcp = endpoint.kind == Endpoint::Kind::TCP;
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = listenFd;
+        return ::epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev) == 0;
+    }
+
+    // Serves until stop() is called.
+    void run() {
+        epoll_event events[kMaxEvents];
+        while (!stopping.load(std::memory_order_acquire)) {
+            int n = ::epoll_wait(epollFd, events, kMaxEvents, -1);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return;
+            }
+            for (int i = 0; i < n; ++i) {
+                int fd = events[i].data.fd;
+                if (fd == listenFd) {
+                    acceptAll();
+                } else if (fd == wakeFd) {
+                    std::uint64_t count;
+                    while (::read(wakeFd, &count, sizeof(count)) > 0) {}
+                    finishJobs();
+                } else {
+                    auto it = connections.find(fd);
+                    if (it == connections.end()) continue;
+                    Connection& c = *it->second;
+                    std::uint32_t ev = events[i].events;
+                    if (ev & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) readAvailable(c);
+                    if (!c.dead && (ev & EPOLLOUT)) writePending(c);
+                    advance(c);
+                    reap(c);
+                }
+            }
+        }
+    }
+
+    // May be called from any thread, including a signal-waiting one.
+    void stop() {
+        stopping.store(true, std::memory_order_release);
+        wake();
+    }
+
+    ServerStats stats() const {
+        ServerStats s;
+        s.accepted = accepted.load(std::memory_order_relaxed);
+        s.jobs = jobs.load(std::memory_order_relaxed);
+        s.bytesIn = bytesIn.load(std::memory_order_relaxed);
+        s.bytesOut = bytesOut.load(std::memory_order_relaxed);
+        return s;
+    }
+};
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef FLAT_JSON_HPP
+#define FLAT_JSON_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace infrastructure {
+
+// Reader for the request bodies of the HTTP API: one JSON object whose
+// values are strings, numbers, booleans or null. Values are views into
+// the body unless a string contains escapes, in which case it is decoded
+// into per-field storage.
+class FlatJson {
+public:
+    static constexpr std::size_t kMaxFields = 16;
+
+private:
+    struct Field {
+        std::string_view key;
+        std::string_view value;
+        std::string decoded;
+    };
+
+    Field fields[kMaxFields];
+    std::size_t count = 0;
+
+    static void skipSpace(std::string_view text, std::size_t& i) {
+        while (i < text.size() &&
+               (text[i] == ' ' || text[i] == '\t' || text[i] == '\n' || text[i] == '\r')) {
+            ++i;
+        }
+    }
+
+    static int hexValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    // Value of the 4 hex digits at raw[at], or -1.
+    static long hex4(std::string_view raw, std::size_t at) {
+        if (at + 4 > raw.size()) return -1;
+        long code = 0;
+        for (std::size_t d = 0; d < 4; ++d) {
+            int h = hexValue(raw[at + d]);
+            if (h < 0) return -1;
+            code = code * 16 + h;
+        }
+        return code;
+    }
+
+    static void appendUtf8(std::string& out, unsigned code) {
+        if (code < 0x80) {
+            out.push_back(static_cast<char>(code));
+        } else if (code < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else if (code < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+    }
+
+    // Reads a string starting at the opening quote. value views the raw
+    // text, or decoded when escapes are present.
+    static bool readString(std::string_view text, std::size_t& i,
+                           std::string_view& value, std::string* decoded)
+    {
+        std::size_t start = ++i;
+        bool escaped = false;
+        while (i < text.size() && text[i] != '"') {
+            if (text[i] == '\\') {
+                escaped = true;
+                ++i;
+            }
+            ++i;
+        }
+        if (i >= text.size()) return false;
+        std::string_view raw = text.substr(start, i - start);
+        ++i;
+        if (!escaped) {
+            value = raw;
+            return true;
+        }
+        if (!decoded) return false;  // escaped keys are not supported
+        decoded->clear();
+        for (std::size_t k = 0; k < raw.size(); ++k) {
+            char c = raw[k];
+            if (c != '\\') {
+                decoded->push_back(c);
+                continue;
+            }
+            char e = raw[++k];
+            switch (e) {
+                case 'n': decoded->push_back('\n'); break;
+                case 't': decoded->push_back('\t'); break;
+                case 'r': decoded->push_back('\r'); break;
+                case 'b': decoded->push_back('\b'); break;
+                case 'f': decoded->push_back('\f'); break;
+                case 'u': {
+                    // A surrogate pair becomes one code point; lone
+                    // surrogates and NUL are rejected.
+                    long code = hex4(raw, k + 1);
+                    if (code <= 0 || (code >= 0xDC00 && code <= 0xDFFF)) return false;
+                    k += 4;
+                    if (code >= 0xD800 && code <= 0xDBFF) {
+                        if (k + 2 >= raw.size() || raw[k + 1] != '\\' || raw[k + 2] != 'u') {
+                            return false;
+                        }
+                        long low = hex4(raw, k + 3);
+                        if (low < 0xDC00 || low > 0xDFFF) return false;
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                        k += 6;
+                    }
+                    appendUtf8(*decoded, static_cast<unsigned>(code));
+                    break;
+                }
+                default: decoded->push_back(e); break;  // '"', '\\', '/'
+            }
+        }
+        value = *decoded;
+        return true;
+    }
+
+public:
+    bool parse(std::string_view text) {
+        count = 0;
+        std::size_t i = 0;
+        skipSpace(text, i);
+        if (i >= text.size() || text[i] != '{') return false;
+        ++i;
+        skipSpace(text, i);
+        if (i < text.size() && text[i] == '}') return true;
+
+        for (;;) {
+            if (count == kMaxFields) return false;
+            Field& field = fields[count];
+            skipSpace(text, i);
+            if (i >= text.size() || text[i] != '"') return false;
+            if (!readString(text, i, field.key, nullptr)) return false;
+            skipSpace(text, i);
+            if (i >= text.size() || text[i] != ':') return false;
+            ++i;
+            skipSpace(text, i);
+            if (i >= text.size()) return false;
+            if (text[i] == '"') {
+                if (!readString(text, i, field.value, &field.decoded)) return false;
+            } else {
+                std::size_t start = i;
+                while (i < text.size() && text[i] != ',' && text[i] != '}' &&
+                       text[i] != ' ' && text[i] != '\n' && text[i] != '\r' && text[i] != '\t') {
+                    ++i;
+                }
+                if (i == start) return false;
+                field.value = text.substr(start, i - start);
+            }
+            ++count;
+            skipSpace(text, i);
+            if (i >= text.size()) return false;
+            if (text[i] == '}') return true;
+            if (text[i] != ',') return false;
+            ++i;
+        }
+    }
+
+    // Value of key, or an empty view if absent.
+    std::string_view get(std::string_view key) const {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (fields[i].key == key) return fields[i].value;
+        }
+        return {};
+    }
+
+    bool has(std::string_view key) const {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (fields[i].key == key) return true;
+        }
+        return false;
+    }
+};
+
+} // namespace infrastructure
+
+#endif
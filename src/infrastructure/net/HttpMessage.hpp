@@ -0,0 +1,174 @@
+#ifndef HTTP_MESSAGE_HPP
+#define HTTP_MESSAGE_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "../../domain/models/EnumNames.hpp"
+
+namespace infrastructure {
+
+// HTTP/1.x request parsed in place: every view points into the receive
+// buffer, so nothing is copied and the views are only valid until the
+// buffer is consumed.
+struct HttpRequest {
+    static constexpr std::size_t kMaxHeaders = 32;
+
+    struct Header {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    std::string_view method;
+    std::string_view path;    // target without the query
+    std::string_view query;   // after '?', may be empty
+    int minorVersion = 1;
+    Header headers[kMaxHeaders];
+    std::size_t headerCount = 0;
+    std::string_view body;
+    bool keepAlive = true;
+
+    std::string_view header(std::string_view name) const {
+        for (std::size_t i = 0; i < headerCount; ++i) {
+            if (domain::enumnames::equalsIgnoreCase(headers[i].name, name)) {
+                return headers[i].value;
+            }
+        }
+        return {};
+    }
+
+    // Value of key in the query string (not percent-decoded).
+    std::string_view queryParam(std::string_view key) const {
+        std::string_view rest = query;
+        while (!rest.empty()) {
+            auto amp = rest.find('&');
+            std::string_view pair = rest.substr(0, amp);
+            rest.remove_prefix(amp == std::string_view::npos ? rest.size() : amp + 1);
+            auto eq = pair.find('=');
+            if (pair.substr(0, eq) == key) {
+                return eq == std::string_view::npos ? std::string_view() : pair.substr(eq + 1);
+            }
+        }
+        return {};
+    }
+};
+
+namespace http {
+
+enum class ParseStatus { COMPLETE, INCOMPLETE, BAD };
+
+constexpr std::size_t kMaxHeaderBytes = 16 * 1024;
+constexpr std::size_t kMaxBodyBytes = 1 << 20;
+
+inline std::string_view trim(std::string_view s) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t')) s.remove_suffix(1);
+    return s;
+}
+
+// Parses the request at the front of input. On COMPLETE, consumed is the
+// size of the request including its body. Bodies need Content-Length;
+// chunked requests are rejected as BAD.
+inline ParseStatus parseRequest(std::string_view input, HttpRequest& req, std::size_t& consumed) {
+    auto headEnd = input.find("\r\n\r\n");
+    if (headEnd == std::string_view::npos) {
+        return input.size() > kMaxHeaderBytes ? ParseStatus::BAD : ParseStatus::INCOMPLETE;
+    }
+    std::string_view head = input.substr(0, headEnd + 2);
+
+    // Request line
+    auto lineEnd = head.find("\r\n");
+    std::string_view line = head.substr(0, lineEnd);
+    auto sp1 = line.find(' ');
+    auto sp2 = line.rfind(' ');
+    if (sp1 == std::string_view::npos || sp2 == sp1) return ParseStatus::BAD;
+    req.method = line.substr(0, sp1);
+    std::string_view target = line.substr(sp1 + 1, sp2 - sp1 - 1);
+    std::string_view version = line.substr(sp2 + 1);
+    if (version.size() != 8 || version.substr(0, 7) != "HTTP/1." ||
+        version[7] < '0' || version[7] > '9') {
+        return ParseStatus::BAD;
+    }
+    req.minorVersion = version[7] - '0';
+    auto question = target.find('?');
+    req.path = target.substr(0, question);
+    req.query = question == std::string_view::npos ? std::string_view() : target.substr(question + 1);
+
+    // Headers
+    req.headerCount = 0;
+    std::size_t pos = lineEnd + 2;
+    while (pos < head.size()) {
+        auto end = head.find("\r\n", pos);
+        std::string_view field = head.substr(pos, end - pos);
+        pos = end + 2;
+        auto colon = field.find(':');
+        if (colon == std::string_view::npos || colon == 0) return ParseStatus::BAD;
+        if (req.headerCount == HttpRequest::kMaxHeaders) return ParseStatus::BAD;
+        req.headers[req.headerCount++] = {field.substr(0, colon), trim(field.substr(colon + 1))};
+    }
+
+    std::string_view connection = req.header("Connection");
+    req.keepAlive = req.minorVersion >= 1
+        ? !domain::enumnames::equalsIgnoreCase(connection, "close")
+        : domain::enumnames::equalsIgnoreCase(connection, "keep-alive");
+
+    if (!req.header("Transfer-Encoding").empty()) return ParseStatus::BAD;
+    std::size_t length = 0;
+    std::string_view lengthText = req.header("Content-Length");
+    if (!lengthText.empty()) {
+        auto r = std::from_chars(lengthText.data(), lengthText.data() + lengthText.size(), length);
+        if (r.ec != std::errc() || r.ptr != lengthText.data() + lengthText.size() ||
+            length > kMaxBodyBytes) {
+            return ParseStatus::BAD;
+        }
+    }
+    std::size_t bodyStart = headEnd + 4;
+    if (input.size() - bodyStart < length) return ParseStatus::INCOMPLETE;
+    req.body = input.substr(bodyStart, length);
+    consumed = bodyStart + length;
+    return ParseStatus::COMPLETE;
+}
+
+inline std::string_view reasonPhrase(int status) {
+    switch (status) {
+        case 200: return "OK";
+        case 201: return "Created";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 422: return "Unprocessable Entity";
+        default: return "Internal Server Error";
+    }
+}
+
+// Appends a complete response, JSON unless contentType says otherwise. out
+// is grown once to the final size.
+inline void appendResponse(std::string& out, int status, std::string_view body, bool keepAlive,
+                           std::string_view contentType = "application/json")
+{
+    char length[24];
+    auto end = std::to_chars(length, length + sizeof(length), body.size()).ptr;
+    std::string_view reason = reasonPhrase(status);
+
+    out.reserve(out.size() + 128 + body.size());
+    out += "HTTP/1.1 ";
+    char code[4] = {static_cast<char>('0' + status / 100), static_cast<char>('0' + status / 10 % 10),
+                    static_cast<char>('0' + status % 10), ' '};
+    out.append(code, 4);
+    out += reason;
+    out += "\r\nContent-Type: ";
+    out += contentType;
+    out += "\r\nContent-Length: ";
+    out.append(length, end);
+    if (!keepAlive) out += "\r\nConnection: close";
+    out += "\r\n\r\n";
+    out += body;
+}
+
+} // namespace http
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef SOCKET_HPP
+#define SOCKET_HPP
+
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace infrastructure {
+
+// "tcp:<ipv4>:<port>" or "unix:<path>"; a bare "<ipv4>:<port>" is TCP.
+struct Endpoint {
+    enum class Kind { TCP, UNIX };
+
+    Kind kind = Kind::TCP;
+    std::string host = "127.0.0.1";
+    unsigned short port = 0;
+    std::string path;
+
+    static bool parse(std::string_view text, Endpoint& out) {
+        if (text.substr(0, 5) == "unix:") {
+            out.kind = Kind::UNIX;
+            out.path = std::string(text.substr(5));
+            return !out.path.empty() && out.path.size() < sizeof(sockaddr_un::sun_path);
+        }
+        if (text.substr(0, 4) == "tcp:") text.remove_prefix(4);
+        auto colon = text.rfind(':');
+        if (colon == std::string_view::npos) return false;
+        out.kind = Kind::TCP;
+        if (colon > 0) out.host = std::string(text.substr(0, colon));
+        auto digits = text.substr(colon + 1);
+        auto result = std::from_chars(digits.data(), digits.data() + digits.size(), out.port);
+        return result.ec == std::errc() && result.ptr == digits.data() + digits.size();
+    }
+
+    std::string toString() const {
+        return kind == Kind::UNIX ? "unix:" + path : "tcp:" + host + ":" + std::to_string(port);
+    }
+};
+
+namespace net {
+
+inline bool setNonBlocking(int fd) {
+    int flags = ::fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+inline void setNoDelay(int fd) {
+    int one = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+// Builds the socket address; returns its length, or 0 if the host is invalid.
+inline socklen_t toAddress(const Endpoint& endpoint, sockaddr_storage& storage) {
+    std::memset(&storage, 0, sizeof(storage));
+    if (endpoint.kind == Endpoint::Kind::UNIX) {
+        auto* addr = reinterpret_cast<sockaddr_un*>(&storage);
+        addr->sun_family = AF_UNIX;
+        std::memcpy(addr->sun_path, endpoint.path.c_str(), endpoint.path.size() + 1);
+        return sizeof(sockaddr_un);
+    }
+    auto* addr = reinterpret_cast<sockaddr_in*>(&storage);
+    addr->sin_family = AF_INET;
+    addr->sin_port = htons(endpoint.port);
+    if (::inet_pton(AF_INET, endpoint.host.c_str(), &addr->sin_addr) != 1) return 0;
+    return sizeof(sockaddr_in);
+}
+
+// Non-blocking listening socket, or -1. A stale Unix socket file is replaced.
+inline int listenOn(const Endpoint& endpoint, int backlog = 1024) {
+    sockaddr_storage storage;
+    socklen_t length = toAddress(endpoint, storage);
+    if (length == 0) return -1;
+
+    int family = endpoint.kind == Endpoint::Kind::UNIX ? AF_UNIX : AF_INET;
+    int fd = ::socket(family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    if (endpoint.kind == Endpoint::Kind::UNIX) {
+        ::unlink(endpoint.path.c_str());
+    } else {
+        int one = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    }
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&storage), length) != 0 ||
+        ::listen(fd, backlog) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Blocking connected socket, or -1.
+inline int connectTo(const Endpoint& endpoint) {
+    sockaddr_storage storage;
+    socklen_t length = toAddress(endpoint, storage);
+    if (length == 0) return -1;
+
+    int family = endpoint.kind == Endpoint::Kind::UNIX ? AF_UNIX : AF_INET;
+    int fd = ::socket(family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&storage), length) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    if (endpoint.kind == Endpoint::Kind::TCP) setNoDelay(fd);
+    return fd;
+}
+
+} // namespace net
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef CHANNEL_ADAPTERS_HPP
+#define CHANNEL_ADAPTERS_HPP
+
+#include <memory>
+#include <string>
+
+#include "../../domain/async/Task.hpp"
+#include "../../domain/interfaces/INotificationChannel.hpp"
+#include "../../domain/interfaces/IAsyncNotificationChannel.hpp"
+#include "../async/EventLoop.hpp"
+
+namespace infrastructure {
+
+// Exposes a blocking channel through the awaitable interface. The send
+// still runs inline on whichever thread resumes the task.
+class SyncToAsyncChannel : public domain::IAsyncNotificationChannel {
+private:
+    std::shared_ptr<domain::INotificationChannel> inner;
+
+public:
+    explicit SyncToAsyncChannel(std::shared_ptr<domain::INotificationChannel> channel)
+        : inner(channel) {}
+
+    domain::Task<bool> sendAsync(std::string recipient, std::string message) override {
+        co_return inner->send(recipient, message);
+    }
+
+    std::string getChannelName() const override {
+        return inner->getChannelName();
+    }
+};
+
+// Exposes an awaitable channel through the blocking interface by driving an
+// event loop of its own until the send completes. Each call gets a fresh
+// loop, so concurrent callers do not share one.
+class AsyncToSyncChannel : public domain::INotificationChannel {
+private:
+    std::shared_ptr<domain::IAsyncNotificationChannel> inner;
+
+public:
+    explicit AsyncToSyncChannel(std::shared_ptr<domain::IAsyncNotificationChannel> channel)
+        : inner(channel) {}
+
+    bool send(const std::string& recipient, const std::string& message) override {
+        EventLoop loop;
+        return loop.syncWait(inner->sendAsync(recipient, message));
+    }
+
+    std::string getChannelName() const override {
+        return inner->getChannelName();
+    }
+};
+
+} // namespace infrastructure
+
+#endif
@@ -2,8 +2,8 @@
 #define EMAIL_NOTIFICATION_HPP
 
 #include <string>
-#include <iostream>
 #include "../../domain/interfaces/INotificationChannel.hpp"
+#include "../console/BufferedConsoleSink.hpp"
 
 namespace infrastructure {
 
@@ -12,8 +12,8 @@ public:
     bool send(const std::string& recipient,
               const std::string& message) override 
     {
-        std::cout << "[Email] Sending to " << recipient << ":\n"
-                  << message << std::endl;
+        BufferedConsoleSink::getInstance().writeLine(
+            "[Email] Sending to ", recipient, ":\n", message);
         return true; 
     }
 
@@ -1,20 +1,32 @@
 #ifndef INMEMORY_CUSTOMER_REPOSITORY_HPP
 #define INMEMORY_CUSTOMER_REPOSITORY_HPP
 
+#include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 
 #include "../../domain/interfaces/ICustomerRepository.hpp"
 #include "../../domain/models/Customer.hpp"
+#include "RepositoryMetrics.hpp"
+#include "../../domain/tracing/Tracer.hpp"
 
 namespace infrastructure {
 
 class InMemoryCustomerRepository : public domain::ICustomerRepository {
 private:
     std::map<std::string, std::shared_ptr<domain::Customer>> customers;
+    mutable std::shared_mutex mutex;
+    RepositoryMetrics metrics{"customers"};
 
-    InMemoryCustomerRepository() = default;
+    InMemoryCustomerRepository() {
+        domain::MetricsRegistry::getInstance().gauge(
+            "repository_entries", "Entries held by the repository",
+            domain::metrics::label("repository", "customers"),
+            [this] { return static_cast<double>(size()); });
+    }
     InMemoryCustomerRepository(const InMemoryCustomerRepository&) = delete;
     InMemoryCustomerRepository& operator=(const InMemoryCustomerRepository&) = delete;
 
@@ -25,11 +37,43 @@ public:
     }
 
     void save(const domain::Customer& customer) override {
-        customers[customer.getId()] =
-            std::make_shared<domain::Customer>(customer);
+        domain::TraceSpan span("InMemoryCustomerRepository::save");
+        metrics.saves.inc();
+        auto copy = std::make_shared<domain::Customer>(customer);
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        customers[customer.getId()] = std::move(copy);
+    }
+
+    void saveAll(std::vector<std::shared_ptr<domain::Customer>> batch) override {
+        domain::TraceSpan span("InMemoryCustomerRepository::saveAll");
+        metrics.saves.inc(batch.size());
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        for (auto& customer : batch) {
+            auto id = customer->getId();
+            customers.insert_or_assign(std::move(id), std::move(customer));
+        }
+    }
+
+    std::vector<std::size_t> insertAll(std::vector<std::shared_ptr<domain::Customer>> batch) override {
+        domain::TraceSpan span("InMemoryCustomerRepository::insertAll");
+        std::vector<std::size_t> existing;
+        {
+            std::unique_lock<std::shared_mutex> lock(mutex);
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                auto id = batch[i]->getId();
+                if (!customers.try_emplace(std::move(id), std::move(batch[i])).second) {
+                    existing.push_back(i);
+                }
+            }
+        }
+        metrics.saves.inc(batch.size() - existing.size());
+        return existing;
     }
 
     std::shared_ptr<domain::Customer> findById(const std::string& id) override {
+        domain::TraceSpan span("InMemoryCustomerRepository::findById");
+        metrics.finds.inc();
+        std::shared_lock<std::shared_mutex> lock(mutex);
         auto it = customers.find(id);
         if (it != customers.end()) {
             return it->second;
@@ -38,12 +82,37 @@ public:
     }
 
     std::vector<std::shared_ptr<domain::Customer>> findAll() override {
+        domain::TraceSpan span("InMemoryCustomerRepository::findAll");
+        metrics.scans.inc();
+        std::shared_lock<std::shared_mutex> lock(mutex);
         std::vector<std::shared_ptr<domain::Customer>> list;
+        list.reserve(customers.size());
         for (auto& pair : customers) {
             list.push_back(pair.second);
         }
         return list;
     }
+
+    std::vector<std::shared_ptr<domain::Customer>> findPage(
+        const std::string& cursor, std::size_t limit,
+        domain::PageDirection direction = domain::PageDirection::AFTER) override
+    {
+        domain::TraceSpan span("InMemoryCustomerRepository::findPage");
+        metrics.pages.inc();
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return domain::paging::fromMap(customers, cursor, limit, direction);
+    }
+
+    std::size_t size() const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return customers.size();
+    }
+
+    // Walks every entry under the read lock, so it costs a full scan.
+    domain::MemoryUsage memoryUsage() const override {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return domain::memory::ofMap(customers);
+    }
 };
 
 } // namespace infrastructure
@@ -1,20 +1,32 @@
 #ifndef INMEMORY_TICKET_REPOSITORY_HPP
 #define INMEMORY_TICKET_REPOSITORY_HPP
 
+#include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 
 #include "../../domain/interfaces/ITicketRepository.hpp"
 #include "../../domain/models/Ticket.hpp"
+#include "RepositoryMetrics.hpp"
+#include "../../domain/tracing/Tracer.hpp"
 
 namespace infrastructure {
 
 class InMemoryTicketRepository : public domain::ITicketRepository {
 private:
     std::map<std::string, std::shared_ptr<domain::Ticket>> tickets;
+    mutable std::shared_mutex mutex;
+    RepositoryMetrics metrics{"tickets"};
 
-    InMemoryTicketRepository() = default;
+    InMemoryTicketRepository() {
+        domain::MetricsRegistry::getInstance().gauge(
+            "repository_entries", "Entries held by the repository",
+            domain::metrics::label("repository", "tickets"),
+            [this] { return static_cast<double>(size()); });
+    }
     InMemoryTicketRepository(const InMemoryTicketRepository&) = delete;
     InMemoryTicketRepository& operator=(const InMemoryTicketRepository&) = delete;
 
@@ -25,11 +37,43 @@ public:
     }
 
     void save(const domain::Ticket& ticket) override {
-        tickets[ticket.getId()] =
-            std::make_shared<domain::Ticket>(ticket);
+        domain::TraceSpan span("InMemoryTicketRepository::save");
+        metrics.saves.inc();
+        auto copy = std::make_shared<domain::Ticket>(ticket);
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        tickets[ticket.getId()] = std::move(copy);
+    }
+
+    void saveAll(std::vector<std::shared_ptr<domain::Ticket>> batch) override {
+        domain::TraceSpan span("InMemoryTicketRepository::saveAll");
+        metrics.saves.inc(batch.size());
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        for (auto& ticket : batch) {
+            auto id = ticket->getId();
+            tickets.insert_or_assign(std::move(id), std::move(ticket));
+        }
+    }
+
+    std::vector<std::size_t> insertAll(std::vector<std::shared_ptr<domain::Ticket>> batch) override {
+        domain::TraceSpan span("InMemoryTicketRepository::insertAll");
+        std::vector<std::size_t> existing;
+        {
+            std::unique_lock<std::shared_mutex> lock(mutex);
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                auto id = batch[i]->getId();
+                if (!tickets.try_emplace(std::move(id), std::move(batch[i])).second) {
+                    existing.push_back(i);
+                }
+            }
+        }
+        metrics.saves.inc(batch.size() - existing.size());
+        return existing;
     }
 
     std::shared_ptr<domain::Ticket> findById(const std::string& id) override {
+        domain::TraceSpan span("InMemoryTicketRepository::findById");
+        metrics.finds.inc();
+        std::shared_lock<std::shared_mutex> lock(mutex);
         auto it = tickets.find(id);
         if (it != tickets.end()) {
             return it->second;
@@ -38,12 +82,37 @@ public:
     }
 
     std::vector<std::shared_ptr<domain::Ticket>> findAll() override {
+        domain::TraceSpan span("InMemoryTicketRepository::findAll");
+        metrics.scans.inc();
+        std::shared_lock<std::shared_mutex> lock(mutex);
         std::vector<std::shared_ptr<domain::Ticket>> list;
+        list.reserve(tickets.size());
         for (auto& pair : tickets) {
             list.push_back(pair.second);
         }
         return list;
     }
+
+    std::vector<std::shared_ptr<domain::Ticket>> findPage(
+        const std::string& cursor, std::size_t limit,
+        domain::PageDirection direction = domain::PageDirection::AFTER) override
+    {
+        domain::TraceSpan span("InMemoryTicketRepository::findPage");
+        metrics.pages.inc();
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return domain::paging::fromMap(tickets, cursor, limit, direction);
+    }
+
+    std::size_t size() const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return tickets.size();
+    }
+
+    // Walks every entry under the read lock, so it costs a full scan.
+    domain::MemoryUsage memoryUsage() const override {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return domain::memory::ofMap(tickets);
+    }
 };
 
 } // namespace infrastructure
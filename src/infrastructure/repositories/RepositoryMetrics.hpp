@@ -0,0 +1,31 @@
+#ifndef REPOSITORY_METRICS_HPP
+#define REPOSITORY_METRICS_HPP
+
+#include <string>
+
+#include "../../domain/metrics/MetricsRegistry.hpp"
+
+namespace infrastructure {
+
+// Calls per repository operation, labelled with the repository name.
+struct RepositoryMetrics {
+    domain::Counter& saves;
+    domain::Counter& finds;
+    domain::Counter& scans;
+    domain::Counter& pages;
+
+    static domain::Counter& counter(const std::string& repository, const char* operation) {
+        return domain::MetricsRegistry::getInstance().counter(
+            "repository_operations_total", "Repository calls",
+            domain::metrics::label("repository", repository) + "," +
+                domain::metrics::label("operation", operation));
+    }
+
+    explicit RepositoryMetrics(const std::string& repository)
+        : saves(counter(repository, "save")), finds(counter(repository, "findById")),
+          scans(counter(repository, "findAll")), pages(counter(repository, "findPage")) {}
+};
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef CHROME_TRACE_WRITER_HPP
+#define CHROME_TRACE_WRITER_HPP
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../../domain/tracing/Tracer.hpp"
+
+namespace infrastructure {
+
+namespace chrome {
+
+// Microseconds with three decimals, as trace-event timestamps expect.
+inline void appendMicros(std::string& out, std::uint64_t ns) {
+    char buf[24];
+    auto end = std::to_chars(buf, buf + sizeof(buf), ns / 1000).ptr;
+    out.append(buf, end);
+    unsigned fraction = static_cast<unsigned>(ns % 1000);
+    out += '.';
+    out += static_cast<char>('0' + fraction / 100);
+    out += static_cast<char>('0' + fraction / 10 % 10);
+    out += static_cast<char>('0' + fraction % 10);
+}
+
+// Trace-event JSON for chrome://tracing and Perfetto: one complete ("X")
+// event per span, one tid per traced thread.
+inline void appendTrace(std::string& out, const std::vector<domain::SpanEvent>& events) {
+    out += "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    char buf[16];
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        auto& e = events[i];
+        if (i) out += ',';
+        out += "\n{\"name\":\"";
+        out += e.name;
+        out += "\",\"cat\":\"app\",\"ph\":\"X\",\"pid\":1,\"tid\":";
+        out.append(buf, std::to_chars(buf, buf + sizeof(buf), e.thread).ptr);
+        out += ",\"ts\":";
+        appendMicros(out, e.startNs);
+        out += ",\"dur\":";
+        appendMicros(out, e.durationNs);
+        out += '}';
+    }
+    out += "\n]}\n";
+}
+
+// Writes the spans currently held by the tracer to path.
+inline bool writeTrace(const std::string& path) {
+    std::string text;
+    appendTrace(text, domain::Tracer::getInstance().collect());
+    std::FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) return false;
+    bool ok = std::fwrite(text.data(), 1, text.size(), f) == text.size();
+    return std::fclose(f) == 0 && ok;
+}
+
+} // namespace chrome
+
+} // namespace infrastructure
+
+#endif
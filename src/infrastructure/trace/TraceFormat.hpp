@@ -0,0 +1,43 @@
+#ifndef TRACE_FORMAT_HPP
+#define TRACE_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../../domain/interfaces/IOperationRecorder.hpp"
+
+namespace infrastructure {
+
+// Operation trace written by TraceRecorder and replayed by
+// tools/trace_replay. All integers are little-endian, records unaligned:
+//   header : kMagic (8 bytes)
+//   record : u32 length of the rest of the record, u8 operation type,
+//            u8 ok, u8 code[0], u8 code[1], u32 number,
+//            u64 start (ns since the recorder was opened), u64 duration ns,
+//            textFields(type) x str, then str result if hasResult(type)
+//   str    : u32 length, length bytes
+// Fields are those of domain::OperationRecord.
+namespace trace {
+
+constexpr char kMagic[8] = {'C', 'P', 'T', 'R', 'A', 'C', 'E', '1'};
+
+constexpr std::size_t kFixedBytes = 4 + 4 + 8 + 8;
+
+inline std::size_t textFields(domain::OperationType type) {
+    switch (type) {
+        case domain::OperationType::REGISTER_CUSTOMER: return 3;
+        case domain::OperationType::CREATE_TICKET: return 2;
+        default: return 1;
+    }
+}
+
+inline bool hasResult(domain::OperationType type) {
+    return type == domain::OperationType::REGISTER_CUSTOMER ||
+           type == domain::OperationType::CREATE_TICKET;
+}
+
+} // namespace trace
+
+} // namespace infrastructure
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef TRACE_READER_HPP
+#define TRACE_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "TraceFormat.hpp"
+#include "../import/MappedFile.hpp"
+
+namespace infrastructure {
+
+// One record of a trace; views point into the mapped file.
+struct TraceEntry {
+    domain::OperationType type = domain::OperationType::GET_CUSTOMER;
+    bool ok = false;
+    std::uint8_t code[2] = {0, 0};
+    std::uint32_t number = 0;
+    std::uint64_t startNs = 0;
+    std::uint64_t durationNs = 0;
+    std::string_view text[3];
+    std::string_view result;
+};
+
+// Sequential reader for files written by TraceRecorder. A record cut off
+// by a crash ends the trace and sets truncated().
+class TraceReader {
+private:
+    MappedFile file;
+    std::string_view data;
+    std::size_t offset = 0;
+    bool valid = false;
+    bool cut = false;
+
+    template <typename T>
+    static T load(const char* p) {
+        T value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    static bool readString(std::string_view record, std::size_t& pos, std::string_view& value) {
+        if (record.size() - pos < 4) return false;
+        std::uint32_t length = load<std::uint32_t>(record.data() + pos);
+        pos += 4;
+        if (record.size() - pos < length) return false;
+        value = record.substr(pos, length);
+        pos += length;
+        return true;
+    }
+
+public:
+    explicit TraceReader(const std::string& path) : file(path) {
+        data = file.view();
+        valid = file.isOpen() && data.size() >= sizeof(trace::kMagic) &&
+                std::memcmp(data.data(), trace::kMagic, sizeof(trace::kMagic)) == 0;
+        offset = sizeof(trace::kMagic);
+    }
+
+    bool isValid() const { return valid; }
+    bool truncated() const { return cut; }
+
+    bool next(TraceEntry& entry) {
+        if (!valid || offset >= data.size()) return false;
+        if (data.size() - offset < 4) {
+            cut = true;
+            return false;
+        }
+        std::uint32_t size = load<std::uint32_t>(data.data() + offset);
+        if (size < trace::kFixedBytes || data.size() - offset - 4 < size) {
+            cut = true;
+            return false;
+        }
+        std::string_view record = data.substr(offset + 4, size);
+        const char* p = record.data();
+        entry.type = static_cast<domain::OperationType>(p[0]);
+        if (static_cast<std::size_t>(entry.type) >= domain::kOperationTypes) {
+            cut = true;
+            return false;
+        }
+        entry.ok = p[1] != 0;
+        entry.code[0] = static_cast<std::uint8_t>(p[2]);
+        entry.code[1] = static_cast<std::uint8_t>(p[3]);
+        entry.number = load<std::uint32_t>(p + 4);
+        entry.startNs = load<std::uint64_t>(p + 8);
+        entry.durationNs = load<std::uint64_t>(p + 16);
+
+        std::size_t pos = trace::kFixedBytes;
+        std::size_t fields = trace::textFields(entry.type);
+        for (std::size_t i = 0; i < 3; ++i) {
+            entry.text[i] = {};
+            if (i < fields && !readString(record, pos, entry.text[i])) {
+                cut = true;
+                return false;
+            }
+        }
+        entry.result = {};
+        if (trace::hasResult(entry.type) && !readString(record, pos, entry.result)) {
+            cut = true;
+            return false;
+        }
+        offset += 4 + size;
+        return true;
+    }
+};
+
+} // namespace infrastructure
+
+#endif
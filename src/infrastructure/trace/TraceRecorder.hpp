@@ -0,0 +1,104 @@
+#ifndef TRACE_RECORDER_HPP
+#define TRACE_RECORDER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "TraceFormat.hpp"
+#include "../../domain/interfaces/IOperationRecorder.hpp"
+#include "../export/ExportSink.hpp"
+
+namespace infrastructure {
+
+// Appends every recorded service call to a trace file, see TraceFormat.hpp.
+// Records are serialized straight into a 1 MiB buffer under a mutex and
+// reach the file one buffer at a time, so recording costs a lock and a
+// copy of the arguments per call.
+class TraceRecorder : public domain::IOperationRecorder {
+private:
+    static constexpr std::size_t kBufferBytes = 1 << 20;
+
+    std::mutex mutex;
+    ExportSink sink{kBufferBytes};
+    domain::OperationRecord::Clock::time_point origin;
+    std::size_t records = 0;
+    bool opened = false;
+
+    template <typename T>
+    static char* putRaw(char* p, T value) {
+        std::memcpy(p, &value, sizeof(value));
+        return p + sizeof(value);
+    }
+
+    static char* putString(char* p, std::string_view text) {
+        p = putRaw(p, static_cast<std::uint32_t>(text.size()));
+        std::memcpy(p, text.data(), text.size());
+        return p + text.size();
+    }
+
+public:
+    ~TraceRecorder() override { close(); }
+
+    bool open(const std::string& path) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!sink.open(path, false)) return false;
+        char* p = sink.reserve(sizeof(trace::kMagic));
+        std::memcpy(p, trace::kMagic, sizeof(trace::kMagic));
+        sink.commit(p + sizeof(trace::kMagic));
+        origin = domain::OperationRecord::Clock::now();
+        opened = true;
+        return true;
+    }
+
+    void record(const domain::OperationRecord& op) override {
+        std::size_t fields = trace::textFields(op.type);
+        bool withResult = trace::hasResult(op.type);
+        std::size_t size = trace::kFixedBytes;
+        for (std::size_t i = 0; i < fields; ++i) size += 4 + op.text[i].size();
+        if (withResult) size += 4 + op.result.size();
+
+        auto since = std::chrono::duration_cast<std::chrono::nanoseconds>(op.start - origin).count();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!opened) return;
+        char* p = sink.reserve(4 + size);
+        p = putRaw(p, static_cast<std::uint32_t>(size));
+        p = putRaw(p, static_cast<std::uint8_t>(op.type));
+        p = putRaw(p, static_cast<std::uint8_t>(op.ok));
+        p = putRaw(p, op.code[0]);
+        p = putRaw(p, op.code[1]);
+        p = putRaw(p, op.number);
+        p = putRaw(p, static_cast<std::uint64_t>(since > 0 ? since : 0));
+        p = putRaw(p, op.durationNs);
+        for (std::size_t i = 0; i < fields; ++i) p = putString(p, op.text[i]);
+        if (withResult) p = putString(p, op.result);
+        sink.commit(p);
+        ++records;
+    }
+
+    // Flushes and closes the trace; false if a write failed.
+    bool close() {
+        std::lock_guard<std::mutex> lock(mutex);
+        opened = false;
+        return sink.close();
+    }
+
+    std::size_t recordCount() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return records;
+    }
+
+    std::size_t bytesWritten() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return sink.bytesWritten();
+    }
+};
+
+} // namespace infrastructure
+
+#endif
@@ -1,30 +1,197 @@
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <thread>
+
+#include <pthread.h>
 
 // Client
+#include "client/BatchRunner.hpp"
+#include "client/BinaryProtocolHandler.hpp"
 #include "client/CLI.hpp"
+#include "client/CommandProcessor.hpp"
+#include "client/HttpApiHandler.hpp"
+#include "client/LineProtocolHandler.hpp"
+#include "client/LineReader.hpp"
 
 // Domain
 #include "domain/services/CustomerService.hpp"
 #include "domain/services/TicketService.hpp"
 #include "domain/services/NotificationService.hpp"
 
+// Infrastructure - import & export
+#include "infrastructure/export/TicketExporter.hpp"
+#include "infrastructure/import/CsvImporter.hpp"
+
 // Infrastructure - repositories
 #include "infrastructure/repositories/InMemoryCustomerRepository.hpp"
 #include "infrastructure/repositories/InMemoryTicketRepository.hpp"
 
-// Infrastructure - logging
+// Infrastructure - network server
+#include "infrastructure/net/EpollServer.hpp"
+
+// Infrastructure - operation trace & metrics
+#include "infrastructure/metrics/MetricsFileExporter.hpp"
+#include "infrastructure/trace/ChromeTraceWriter.hpp"
+#include "infrastructure/trace/TraceRecorder.hpp"
+
+// Infrastructure - console output & logging
+#include "infrastructure/console/BufferedConsoleSink.hpp"
 #include "infrastructure/logging/ConsoleLogger.hpp"
 
+// Infrastructure - allocation accounting, opt-in with -DTRACK_ALLOCATIONS
+#ifdef TRACK_ALLOCATIONS
+#include "infrastructure/memory/AllocationHooks.hpp"
+#endif
+
 // Infrastructure - notifications
+#include "infrastructure/async/EventLoop.hpp"
+#include "infrastructure/notifications/ChannelAdapters.hpp"
 #include "infrastructure/notifications/EmailNotification.hpp"
 #include "infrastructure/notifications/SMSNotification.hpp"
 #include "infrastructure/notifications/PushNotification.hpp"
 
-int main() {
+// Serves requests over a socket until SIGINT or SIGTERM. SIGUSR1 writes
+// the spans traced so far to tracePath, when tracing.
+static int serve(const char* address, std::size_t workerThreads,
+                 domain::IRequestHandler& handler, const char* tracePath)
+{
+    infrastructure::Endpoint endpoint;
+    if (!infrastructure::Endpoint::parse(address, endpoint)) {
+        std::fprintf(stderr, "invalid address %s\n", address);
+        return 1;
+    }
+
+    infrastructure::EpollServer server(handler, workerThreads);
+    if (!server.listen(endpoint)) {
+        std::fprintf(stderr, "cannot listen on %s\n", endpoint.toString().c_str());
+        return 1;
+    }
+
+    // SIGINT, SIGTERM and SIGUSR1 are blocked in main before any thread starts
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGUSR1);
+    std::thread waiter([&] {
+        int received;
+        while (sigwait(&signals, &received) == 0 && received == SIGUSR1) {
+            if (tracePath && !infrastructure::chrome::writeTrace(tracePath)) {
+                std::fprintf(stderr, "cannot write %s\n", tracePath);
+            }
+        }
+        server.stop();
+    });
+
+    std::fprintf(stderr, "listening on %s with %zu workers\n",
+                 endpoint.toString().c_str(), workerThreads);
+    server.run();
+
+    pthread_kill(waiter.native_handle(), SIGTERM);
+    waiter.join();
+    if (endpoint.kind == infrastructure::Endpoint::Kind::UNIX) ::unlink(endpoint.path.c_str());
+
+    auto stats = server.stats();
+    std::fprintf(stderr, "served %llu connections, %llu jobs, %llu bytes in, %llu bytes out\n",
+                 static_cast<unsigned long long>(stats.accepted),
+                 static_cast<unsigned long long>(stats.jobs),
+                 static_cast<unsigned long long>(stats.bytesIn),
+                 static_cast<unsigned long long>(stats.bytesOut));
+    return 0;
+}
+
+// Usage: app                  interactive menu
+//        app --batch [file]    run '|'-separated commands from file (or
+//                              stdin), see client/CommandProcessor.hpp
+//        app --serve <address> [--workers N] [--protocol line|http|bin]
+//                              serve the same commands over
+//                              tcp:<ip>:<port> or unix:<path>, one per line,
+//                              the JSON API of client/HttpApiHandler.hpp, or
+//                              the batched frames of net/BinaryProtocol.hpp
+//        any of the above with --record <trace>
+//                              write every service call to a trace for
+//                              tools/trace_replay
+//        and/or --metrics <file>
+//                              rewrite a Prometheus text snapshot every 5 s
+//        and/or --trace <file> [--trace-sample N]
+//                              trace one in N call trees (default 100) and
+//                              write them as Chrome trace-event JSON on exit
+//                              and, when serving, on SIGUSR1
+int main(int argc, char** argv) {
+    // Console output is flushed by BufferedConsoleSink, not per line
+    std::ios::sync_with_stdio(false);
+
+    const char* recordPath = nullptr;
+    const char* metricsPath = nullptr;
+    const char* tracePath = nullptr;
+    const char* traceSample = "100";
+    for (int i = 1; i + 1 < argc;) {
+        const char** target = std::strcmp(argv[i], "--record") == 0 ? &recordPath
+                            : std::strcmp(argv[i], "--metrics") == 0 ? &metricsPath
+                            : std::strcmp(argv[i], "--trace") == 0 ? &tracePath
+                            : std::strcmp(argv[i], "--trace-sample") == 0 ? &traceSample : nullptr;
+        if (!target) {
+            ++i;
+            continue;
+        }
+        *target = argv[i + 1];
+        for (int j = i; j + 2 <= argc; ++j) argv[j] = argv[j + 2];
+        argc -= 2;
+    }
+
+    bool batch = argc > 1 && std::strcmp(argv[1], "--batch") == 0;
+    const char* batchInput = argc > 2 ? argv[2] : "-";
+    bool server = argc > 2 && std::strcmp(argv[1], "--serve") == 0;
+    std::size_t workerThreads = std::max(1u, std::thread::hardware_concurrency());
+    const char* protocol = "line";
+    for (int i = 3; server && i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--workers") == 0) {
+            workerThreads = static_cast<std::size_t>(std::max(1, std::atoi(argv[i + 1])));
+        } else if (std::strcmp(argv[i], "--protocol") == 0) {
+            protocol = argv[i + 1];
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (server && std::strcmp(protocol, "line") != 0 && std::strcmp(protocol, "http") != 0 &&
+        std::strcmp(protocol, "bin") != 0) {
+        std::fprintf(stderr, "unknown protocol %s\n", protocol);
+        return 1;
+    }
+
+    if (server) {
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGINT);
+        sigaddset(&signals, SIGTERM);
+        sigaddset(&signals, SIGUSR1);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    }
+
     // Logger
     auto logger = std::make_shared<infrastructure::ConsoleLogger>();
 
+    if (batch || server) {
+        // Only command replies go to stdout; notifications and warnings
+        // are buffered to stderr. std::cerr is unitbuf by default, which
+        // would turn every write into a write(2).
+        logger->setLevel(domain::LogLevel::WARN);
+        std::cerr.unsetf(std::ios::unitbuf);
+        auto& sink = infrastructure::BufferedConsoleSink::getInstance();
+        sink.setOutput(std::cerr);
+        sink.setPolicy(infrastructure::FlushPolicy::buffered());
+        // Flush the tail of a burst even when no further output follows.
+        // Not in the CLI, which writes std::cout directly, outside the sink.
+        sink.startFlusher();
+    }
+
     // Repositories (Singletons)
     auto& customerRepo = infrastructure::InMemoryCustomerRepository::getInstance();
     auto& ticketRepo   = infrastructure::InMemoryTicketRepository::getInstance();
@@ -32,13 +199,23 @@ int main() {
     // Notification service (Singleton)
     auto& notificationService = domain::NotificationService::getInstance(logger);
 
+    // When serving, notifications are sent from an event loop thread so the
+    // request workers do not wait for them
+    auto notificationLoop = std::make_shared<infrastructure::EventLoop>();
+    if (server) notificationService.setExecutor(notificationLoop);
+    auto addChannel = [&](std::shared_ptr<domain::INotificationChannel> channel) {
+        if (server) {
+            notificationService.addChannel(std::shared_ptr<domain::IAsyncNotificationChannel>(
+                std::make_shared<infrastructure::SyncToAsyncChannel>(channel)));
+        } else {
+            notificationService.addChannel(channel);
+        }
+    };
+
     // Add notification channels
-    notificationService.addChannel(
-        std::make_shared<infrastructure::EmailNotification>());
-    notificationService.addChannel(
-        std::make_shared<infrastructure::SMSNotification>());
-    notificationService.addChannel(
-        std::make_shared<infrastructure::PushNotification>());
+    addChannel(std::make_shared<infrastructure::EmailNotification>());
+    addChannel(std::make_shared<infrastructure::SMSNotification>());
+    addChannel(std::make_shared<infrastructure::PushNotification>());
 
     // Domain services
     auto customerService = std::make_shared<domain::CustomerService>(
@@ -49,9 +226,96 @@ int main() {
         ticketRepo, customerRepo, notificationService, logger
     );
 
+    // Operation trace
+    if (recordPath) {
+        auto recorder = std::make_shared<infrastructure::TraceRecorder>();
+        if (!recorder->open(recordPath)) {
+            std::fprintf(stderr, "cannot open %s\n", recordPath);
+            return 1;
+        }
+        customerService->setRecorder(recorder);
+        ticketService->setRecorder(recorder);
+    }
+
+    // Span tracing
+    if (tracePath) {
+        int oneIn = std::atoi(traceSample);
+        if (oneIn < 1) {
+            std::fprintf(stderr, "invalid --trace-sample %s\n", traceSample);
+            return 1;
+        }
+        domain::Tracer::getInstance().enable(domain::SamplePolicy::oneIn(static_cast<std::uint32_t>(oneIn)));
+    }
+    auto writeTrace = [&] {
+        if (tracePath && !infrastructure::chrome::writeTrace(tracePath)) {
+            std::fprintf(stderr, "cannot write %s\n", tracePath);
+        }
+    };
+
+    // Metrics snapshot file
+    std::unique_ptr<infrastructure::MetricsFileExporter> metricsExporter;
+    if (metricsPath) {
+        metricsExporter = std::make_unique<infrastructure::MetricsFileExporter>(
+            metricsPath, std::chrono::seconds(5));
+        if (!metricsExporter->start()) {
+            std::fprintf(stderr, "cannot write %s\n", metricsPath);
+            return 1;
+        }
+    }
+
+    // Bulk CSV import
+    auto importer = std::make_shared<infrastructure::CsvImporter>(customerRepo, ticketRepo);
+
+    // Streaming ticket export
+    auto exporter = std::make_shared<infrastructure::TicketExporter>(ticketRepo);
+
+    if (server) {
+        // Clients must not read or write server-side files
+        client::CommandProcessor processor(customerService, ticketService, notificationService);
+        client::LineProtocolHandler lineHandler(processor);
+        client::HttpApiHandler httpHandler(customerService, ticketService, notificationService);
+        client::BinaryProtocolHandler binaryHandler(customerService, ticketService);
+        domain::IRequestHandler* handler = &lineHandler;
+        if (std::strcmp(protocol, "http") == 0) handler = &httpHandler;
+        else if (std::strcmp(protocol, "bin") == 0) handler = &binaryHandler;
+        std::thread notifier([&] { notificationLoop->runUntilStopped(); });
+        int status = serve(argv[2], workerThreads, *handler, tracePath);
+        notificationLoop->stop();
+        notifier.join();
+        writeTrace();
+
+        domain::LogSamplerRegistry::getInstance().reportAll(*logger);
+        infrastructure::BufferedConsoleSink::getInstance().flush();
+        return status;
+    }
+
+    if (batch) {
+        auto reader = std::strcmp(batchInput, "-") == 0
+            ? std::make_unique<client::LineReader>()
+            : std::make_unique<client::LineReader>(batchInput);
+        if (!reader->isOpen()) {
+            std::fprintf(stderr, "cannot open %s\n", batchInput);
+            return 1;
+        }
+
+        client::CommandProcessor processor(customerService, ticketService, notificationService,
+                                           importer, exporter);
+        client::BatchRunner runner(processor);
+        auto summary = runner.run(*reader, stdout);
+        writeTrace();
+
+        domain::LogSamplerRegistry::getInstance().reportAll(*logger);
+        infrastructure::BufferedConsoleSink::getInstance().flush();
+        return summary.failed ? 1 : 0;
+    }
+
     // CLI
-    client::CommandLineInterface cli(customerService, ticketService);
+    client::CommandLineInterface cli(customerService, ticketService, notificationService, importer,
+                                     exporter);
     cli.run();
+    writeTrace();
 
+    domain::LogSamplerRegistry::getInstance().reportAll(*logger);
+    infrastructure::BufferedConsoleSink::getInstance().flush();
     return 0;
 }
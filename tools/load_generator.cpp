@@ -0,0 +1,323 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "../src/domain/metrics/LatencyHistogram.hpp"
+#include "../src/infrastructure/net/BinaryProtocol.hpp"
+#include "../src/infrastructure/net/Socket.hpp"
+
+// Closed-loop load generator for `app --serve`. Each connection keeps
+// --depth requests in flight (pipelined) and sends a new one whenever a
+// reply arrives; latency is measured from the send of a request to the
+// arrival of its reply. Half the requests create a ticket, the other half
+// change the status of the last ticket created on that connection.
+// With --protocol http the same requests go to the JSON API as
+// POST /tickets and PUT /tickets/<id>/status on keep-alive connections.
+// With --protocol bin each request is one frame of --batch records.
+// Usage: load_generator --connect <address> [--connections N] [--depth D]
+//                       [--requests N] [--protocol line|http|bin] [--batch B]
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    infrastructure::Endpoint endpoint;
+    std::size_t connections = 4;
+    std::size_t depth = 16;
+    std::size_t requests = 200000;
+    std::size_t batch = 1;
+    std::string protocol = "line";
+};
+
+// One reply at the front of the receive buffer.
+struct Reply {
+    std::size_t size = 0;          // 0 while incomplete
+    bool ok = false;
+    std::string_view id;           // id of a created customer or ticket (the last one)
+};
+
+struct ConnectionResult {
+    std::size_t completed = 0;
+    std::size_t errors = 0;
+    bool failed = false;
+};
+
+static bool sendAll(int fd, const std::string& data) {
+    std::size_t offset = 0;
+    while (offset < data.size()) {
+        ssize_t n = ::send(fd, data.data() + offset, data.size() - offset, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        offset += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+static void appendHttp(std::string& out, std::string_view method, std::string_view path,
+                       std::string_view body)
+{
+    out += method;
+    out += ' ';
+    out += path;
+    out += " HTTP/1.1\r\nHost: load\r\nContent-Length: ";
+    out += std::to_string(body.size());
+    out += "\r\n\r\n";
+    out += body;
+}
+
+static std::string_view jsonId(std::string_view body) {
+    auto key = body.find("\"id\":\"");
+    if (key == std::string_view::npos) return {};
+    auto start = key + 6;
+    return body.substr(start, body.find('"', start) - start);
+}
+
+static void appendBinary(std::string& out, infrastructure::wire::Opcode opcode,
+                         std::size_t batch, std::string_view id, std::uint8_t a, std::uint8_t b)
+{
+    infrastructure::wire::FrameWriter writer(out, opcode, static_cast<std::uint16_t>(batch));
+    for (std::size_t i = 0; i < batch; ++i) {
+        writer.str(id);
+        if (opcode == infrastructure::wire::Opcode::CREATE_TICKET) writer.str("Load test request");
+        writer.u8(a);
+        if (opcode != infrastructure::wire::Opcode::UPDATE_STATUS) writer.u8(b);
+    }
+    writer.finish();
+}
+
+static Reply parseBinaryReply(std::string_view in) {
+    Reply reply;
+    infrastructure::wire::FrameHeader frame;
+    std::size_t consumed = 0;
+    auto status = infrastructure::wire::decodeFrame(in, frame, consumed);
+    if (status == infrastructure::wire::FrameStatus::INCOMPLETE) return reply;
+    reply.size = status == infrastructure::wire::FrameStatus::BAD ? in.size() : consumed;
+    reply.ok = status == infrastructure::wire::FrameStatus::COMPLETE &&
+               frame.opcode != infrastructure::wire::Opcode::BAD_FRAME;
+    infrastructure::wire::FrameReader reader(frame.records);
+    for (std::uint16_t i = 0; reply.ok && i < frame.count; ++i) {
+        reply.ok = reader.u8() == static_cast<std::uint8_t>(infrastructure::wire::Result::OK);
+        auto id = reader.str();
+        if (!id.empty()) reply.id = id;
+    }
+    return reply;
+}
+
+static Reply parseReply(std::string_view in, const std::string& protocol) {
+    Reply reply;
+    if (protocol == "bin") return parseBinaryReply(in);
+    if (protocol == "line") {
+        auto newline = in.find('\n');
+        if (newline == std::string_view::npos) return reply;
+        std::string_view line = in.substr(0, newline);
+        reply.size = newline + 1;
+        reply.ok = line.substr(0, 2) == "OK";
+        if (line.substr(0, 3) == "OK " && line.find('|') == std::string_view::npos) {
+            reply.id = line.substr(3);
+        }
+        return reply;
+    }
+    auto headEnd = in.find("\r\n\r\n");
+    if (headEnd == std::string_view::npos) return reply;
+    auto lengthAt = in.substr(0, headEnd).find("Content-Length: ");
+    std::size_t length = lengthAt == std::string_view::npos
+        ? 0 : std::strtoul(in.data() + lengthAt + 16, nullptr, 10);
+    if (in.size() < headEnd + 4 + length) return reply;
+    reply.size = headEnd + 4 + length;
+    reply.ok = in.size() > 9 && in[9] == '2';
+    if (in.substr(9, 3) == "201") reply.id = jsonId(in.substr(headEnd + 4, length));
+    return reply;
+}
+
+// Sends one request and returns the id in its reply, for setup.
+static std::string request(int fd, const std::string& data, const std::string& protocol) {
+    if (!sendAll(fd, data)) return {};
+    std::string in;
+    char buf[4096];
+    for (;;) {
+        Reply reply = parseReply(in, protocol);
+        if (reply.size) return reply.ok ? std::string(reply.id) : std::string();
+        ssize_t n = ::read(fd, buf, sizeof(buf));
+        if (n <= 0) return {};
+        in.append(buf, static_cast<std::size_t>(n));
+    }
+}
+
+static void runConnection(const Options& options, const std::string& customerId,
+                          std::size_t quota, domain::LatencyHistogram& latency,
+                          ConnectionResult& result)
+{
+    int fd = infrastructure::net::connectTo(options.endpoint);
+    if (fd < 0) {
+        result.failed = true;
+        return;
+    }
+
+    std::vector<Clock::time_point> sentAt(quota);
+    std::size_t sent = 0;
+    std::string lastTicket;
+    std::string out;
+    std::string in;
+    char buf[64 * 1024];
+
+    std::string createBody = "{\"customer_id\":\"" + customerId +
+                             "\",\"description\":\"Load test request\",\"priority\":1,\"category\":0}";
+    bool http = options.protocol == "http";
+    auto appendRequest = [&] {
+        bool update = sent % 2 == 1 && !lastTicket.empty();
+        if (options.protocol == "bin") {
+            if (update) {
+                appendBinary(out, infrastructure::wire::Opcode::UPDATE_STATUS, options.batch,
+                             lastTicket, static_cast<std::uint8_t>(sent % 4), 0);
+            } else {
+                appendBinary(out, infrastructure::wire::Opcode::CREATE_TICKET, options.batch,
+                             customerId, 1, 0);
+            }
+        } else if (http && update) {
+            char body[32];
+            std::snprintf(body, sizeof(body), "{\"status\":%zu}", sent % 4);
+            appendHttp(out, "PUT", "/tickets/" + lastTicket + "/status", body);
+        } else if (http) {
+            appendHttp(out, "POST", "/tickets", createBody);
+        } else if (update) {
+            out += "status|" + lastTicket + "|" + std::to_string(sent % 4) + "\n";
+        } else {
+            out += "ticket|" + customerId + "|Load test request|1|0\n";
+        }
+        sentAt[sent++] = Clock::now();
+    };
+
+    while (sent < quota && sent < options.depth) appendRequest();
+    if (!sendAll(fd, out)) result.failed = true;
+
+    while (!result.failed && result.completed < quota) {
+        ssize_t n = ::read(fd, buf, sizeof(buf));
+        if (n <= 0) {
+            result.failed = true;
+            break;
+        }
+        auto now = Clock::now();
+        in.append(buf, static_cast<std::size_t>(n));
+
+        out.clear();
+        std::size_t start = 0;
+        for (Reply reply = parseReply(in, options.protocol); reply.size;
+             reply = parseReply(std::string_view(in).substr(start), options.protocol)) {
+            start += reply.size;
+            if (!reply.ok) ++result.errors;
+            if (!reply.id.empty()) lastTicket = std::string(reply.id);
+            latency.record(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    now - sentAt[result.completed]).count()));
+            ++result.completed;
+            if (sent < quota) appendRequest();
+        }
+        in.erase(0, start);
+        if (!out.empty() && !sendAll(fd, out)) result.failed = true;
+    }
+    ::close(fd);
+}
+
+static bool parseOptions(int argc, char** argv, Options& options) {
+    bool haveAddress = false;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string flag = argv[i];
+        const char* value = argv[i + 1];
+        if (flag == "--connect") {
+            haveAddress = infrastructure::Endpoint::parse(value, options.endpoint);
+        } else if (flag == "--connections") {
+            options.connections = std::strtoul(value, nullptr, 10);
+        } else if (flag == "--depth") {
+            options.depth = std::strtoul(value, nullptr, 10);
+        } else if (flag == "--requests") {
+            options.requests = std::strtoul(value, nullptr, 10);
+        } else if (flag == "--protocol") {
+            options.protocol = value;
+        } else if (flag == "--batch") {
+            options.batch = std::strtoul(value, nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    bool knownProtocol = options.protocol == "line" || options.protocol == "http" ||
+                         options.protocol == "bin";
+    if (options.protocol != "bin") options.batch = 1;
+    return haveAddress && argc % 2 == 1 && knownProtocol && options.connections > 0 &&
+           options.depth > 0 && options.batch > 0 && options.batch <= UINT16_MAX;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "usage: %s --connect <tcp:ip:port|unix:path> [--connections N]"
+                             " [--depth D] [--requests N] [--protocol line|http|bin] [--batch B]\n", argv[0]);
+        return 2;
+    }
+
+    int setup = infrastructure::net::connectTo(options.endpoint);
+    if (setup < 0) {
+        std::fprintf(stderr, "cannot connect to %s\n", options.endpoint.toString().c_str());
+        return 1;
+    }
+    std::string setupRequest;
+    if (options.protocol == "http") {
+        appendHttp(setupRequest, "POST", "/customers",
+                   R"({"name":"Load","email":"load@example.com","phone":"555-0100","type":0})");
+    } else if (options.protocol == "bin") {
+        infrastructure::wire::FrameWriter writer(setupRequest,
+                                                 infrastructure::wire::Opcode::CREATE_CUSTOMER, 1);
+        writer.str("Load");
+        writer.str("load@example.com");
+        writer.str("555-0100");
+        writer.u8(0);
+        writer.finish();
+    } else {
+        setupRequest = "customer|Load|load@example.com|555-0100|0\n";
+    }
+    std::string customerId = request(setup, setupRequest, options.protocol);
+    ::close(setup);
+    if (customerId.empty()) {
+        std::fprintf(stderr, "setup failed\n");
+        return 1;
+    }
+
+    domain::LatencyHistogram latency;
+    std::vector<ConnectionResult> results(options.connections);
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < options.connections; ++i) {
+        std::size_t quota = options.requests / options.connections +
+                            (i < options.requests % options.connections ? 1 : 0);
+        threads.emplace_back(runConnection, std::cref(options), std::cref(customerId), quota,
+                             std::ref(latency), std::ref(results[i]));
+    }
+    for (auto& t : threads) t.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::size_t completed = 0, errors = 0, failed = 0;
+    for (auto& r : results) {
+        completed += r.completed;
+        errors += r.errors;
+        failed += r.failed ? 1 : 0;
+    }
+    auto snap = latency.snapshot();
+    auto us = [&](double p) { return static_cast<double>(snap.percentile(p)) / 1000.0; };
+
+    std::printf("%s (%s, batch %zu), %zu connections, depth %zu\n",
+                options.endpoint.toString().c_str(), options.protocol.c_str(), options.batch,
+                options.connections, options.depth);
+    std::printf("requests %zu, errors %zu, failed connections %zu, %.3f s\n",
+                completed, errors, failed, seconds);
+    std::printf("throughput %.0f requests/s, %.0f operations/s\n",
+                static_cast<double>(completed) / seconds,
+                static_cast<double>(completed * options.batch) / seconds);
+    std::printf("latency us: p50 %.1f  p90 %.1f  p99 %.1f  p99.9 %.1f  max %.1f\n",
+                us(50), us(90), us(99), us(99.9), static_cast<double>(snap.max) / 1000.0);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,110 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../src/domain/logging/LogRecord.hpp"
+#include "../src/infrastructure/logging/BinaryLogFormat.hpp"
+
+// Turns a file written by infrastructure::BinaryLogger back into text.
+// Usage: log_decoder <binary-log> [> out.txt]
+
+using infrastructure::binlog::RecordKind;
+
+template <typename T>
+static bool read(const char*& p, const char* end, T& value) {
+    if (static_cast<std::size_t>(end - p) < sizeof(T)) return false;
+    std::memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+    return true;
+}
+
+static void appendTimestamp(std::string& out, std::int64_t ns) {
+    std::time_t seconds = static_cast<std::time_t>(ns / 1000000000);
+    std::tm tm{};
+    gmtime_r(&seconds, &tm);
+    char buf[48];
+    std::size_t n = std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm);
+    std::snprintf(buf + n, sizeof(buf) - n, ".%06lld",
+                  static_cast<long long>((ns % 1000000000) / 1000));
+    out += buf;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <binary-log>\n", argv[0]);
+        return 2;
+    }
+
+    std::ifstream in(argv[1], std::ios::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const char* p = data.data();
+    const char* end = p + data.size();
+
+    if (data.size() < sizeof(infrastructure::binlog::kMagic) ||
+        std::memcmp(p, infrastructure::binlog::kMagic, sizeof(infrastructure::binlog::kMagic)) != 0) {
+        std::fprintf(stderr, "%s: not a binary log\n", argv[1]);
+        return 1;
+    }
+    p += sizeof(infrastructure::binlog::kMagic);
+
+    struct Format {
+        domain::LogLevel level = domain::LogLevel::INFO;
+        std::string text;
+    };
+    std::unordered_map<std::uint32_t, Format> formats;
+    std::string out;
+    std::size_t events = 0;
+
+    while (p < end) {
+        RecordKind kind;
+        std::uint32_t id;
+        if (!read(p, end, kind) || !read(p, end, id)) break;
+
+        if (kind == RecordKind::FORMAT) {
+            domain::LogLevel level;
+            std::uint32_t length;
+            if (!read(p, end, level) || !read(p, end, length) ||
+                static_cast<std::size_t>(end - p) < length) break;
+            formats[id].level = level;
+            formats[id].text.assign(p, length);
+            p += length;
+        } else if (kind == RecordKind::EVENT) {
+            std::int64_t timestamp;
+            std::uint32_t size;
+            if (!read(p, end, timestamp) || !read(p, end, size) ||
+                static_cast<std::size_t>(end - p) < size) break;
+            auto it = formats.find(id);
+            out += '[';
+            appendTimestamp(out, timestamp);
+            out += "] ";
+            out += domain::logLevelTag(it != formats.end() ? it->second.level : domain::LogLevel::INFO);
+            domain::formatRecord(it != formats.end() ? it->second.text.c_str() : "{?}",
+                                 reinterpret_cast<const std::byte*>(p), size, out);
+            out += '\n';
+            p += size;
+            ++events;
+        } else {
+            std::fprintf(stderr, "corrupt record at offset %td\n", p - data.data());
+            break;
+        }
+
+        if (out.size() >= (1 << 20)) {
+            std::fwrite(out.data(), 1, out.size(), stdout);
+            out.clear();
+        }
+    }
+
+    std::fwrite(out.data(), 1, out.size(), stdout);
+    if (p < end) {
+        std::fprintf(stderr, "stopped at offset %td of %zu (truncated file?)\n",
+                     p - data.data(), data.size());
+    }
+    std::fprintf(stderr, "%zu events decoded\n", events);
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "../src/infrastructure/logging/MmapLogReader.hpp"
+
+// Prints the records of MmapFileLogger segments and reports, per segment,
+// where the last complete record ends.
+// Usage: mmap_log_reader <segment-file>...
+//        mmap_log_reader --base <path>     (all segments of <path>)
+
+static void printTimestamp(std::int64_t ns) {
+    std::time_t seconds = static_cast<std::time_t>(ns / 1000000000);
+    std::tm tm{};
+    gmtime_r(&seconds, &tm);
+    char buf[32];
+    std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm);
+    std::printf("[%s.%06lld] ", buf, static_cast<long long>((ns % 1000000000) / 1000));
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> files;
+    if (argc == 3 && std::string(argv[1]) == "--base") {
+        files = infrastructure::MmapLogReader::listSegments(argv[2]);
+    } else {
+        files.assign(argv + 1, argv + argc);
+    }
+    if (files.empty()) {
+        std::fprintf(stderr, "usage: %s <segment-file>... | --base <path>\n", argv[0]);
+        return 2;
+    }
+
+    int status = 0;
+    for (const auto& file : files) {
+        infrastructure::MmapLogReader reader(file);
+        auto result = reader.scan([](const infrastructure::MmapLogRecord& record) {
+            printTimestamp(record.timestampNs);
+            std::fwrite(record.text.data(), 1, record.text.size(), stdout);
+            std::fputc('\n', stdout);
+        });
+        if (!result.valid) {
+            std::fprintf(stderr, "%s: not a log segment\n", file.c_str());
+            status = 1;
+            continue;
+        }
+        std::fprintf(stderr, "%s: segment %llu, %zu records, last complete record ends at %zu",
+                     file.c_str(), static_cast<unsigned long long>(result.sequence),
+                     result.records, result.endOffset);
+        if (result.torn) std::fprintf(stderr, ", %zu torn records skipped", result.torn);
+        if (result.gaps) std::fprintf(stderr, ", %zu unfinished headers skipped", result.gaps);
+        if (result.corrupt) std::fprintf(stderr, ", skipped a corrupt header");
+        std::fputc('\n', stderr);
+    }
+    return status;
+}
@@ -0,0 +1,183 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#include "../src/domain/metrics/LatencyHistogram.hpp"
+#include "../src/domain/services/CustomerService.hpp"
+#include "../src/domain/services/NotificationService.hpp"
+#include "../src/domain/services/TicketService.hpp"
+#include "../src/infrastructure/repositories/InMemoryCustomerRepository.hpp"
+#include "../src/infrastructure/repositories/InMemoryTicketRepository.hpp"
+#include "../src/infrastructure/trace/TraceReader.hpp"
+
+// Re-issues a trace recorded with `app ... --record <trace>` against fresh
+// in-memory services, in trace order, on one thread. By default every call
+// starts at its recorded offset; --speed N compresses the schedule N times
+// and --speed max issues calls back to back. Ids created during the replay
+// are mapped onto the recorded ones, so later calls address the same
+// customers and tickets. No notification channels are registered.
+// Usage: trace_replay <trace> [--speed N|max]
+
+using Clock = std::chrono::steady_clock;
+using domain::OperationType;
+
+struct OperationStats {
+    domain::LatencyHistogram replayed;
+    domain::LatencyHistogram recorded;
+    std::size_t mismatches = 0;  // ok differs from the recording
+};
+
+class Replayer {
+private:
+    std::shared_ptr<domain::CustomerService> customers;
+    std::shared_ptr<domain::TicketService> tickets;
+    std::unordered_map<std::string, std::string> ids;  // recorded -> replayed
+    std::string scratch[3];
+
+    // Services take std::string; the scratch strings keep their capacity.
+    const std::string& copy(std::size_t slot, std::string_view text) {
+        return scratch[slot].assign(text.data(), text.size());
+    }
+
+    const std::string& translate(std::size_t slot, std::string_view recorded) {
+        const std::string& id = copy(slot, recorded);
+        auto it = ids.find(id);
+        return it != ids.end() ? it->second : id;
+    }
+
+    void remember(std::string_view recorded, const std::string& replayed) {
+        if (!recorded.empty() && !replayed.empty() && recorded != replayed) {
+            ids.emplace(std::string(recorded), replayed);
+        }
+    }
+
+public:
+    Replayer(std::shared_ptr<domain::CustomerService> cs, std::shared_ptr<domain::TicketService> ts)
+        : customers(std::move(cs)), tickets(std::move(ts)) {}
+
+    // Executes the entry and returns whether it succeeded.
+    bool execute(const infrastructure::TraceEntry& e) {
+        switch (e.type) {
+            case OperationType::REGISTER_CUSTOMER: {
+                auto id = customers->registerCustomer(
+                    copy(0, e.text[0]), copy(1, e.text[1]), copy(2, e.text[2]),
+                    static_cast<domain::CustomerType>(e.code[0]));
+                remember(e.result, id);
+                return true;
+            }
+            case OperationType::CREATE_TICKET: {
+                auto id = tickets->createTicket(
+                    translate(0, e.text[0]), copy(1, e.text[1]),
+                    static_cast<domain::Priority>(e.code[0]),
+                    static_cast<domain::TicketCategory>(e.code[1]));
+                remember(e.result, id);
+                return !id.empty();
+            }
+            case OperationType::UPDATE_STATUS:
+                return tickets->updateTicketStatus(translate(0, e.text[0]),
+                                                   static_cast<domain::TicketStatus>(e.code[0]));
+            case OperationType::GET_CUSTOMER:
+                return customers->getCustomer(translate(0, e.text[0])) != nullptr;
+            case OperationType::GET_TICKET:
+                return tickets->getTicket(translate(0, e.text[0])) != nullptr;
+            case OperationType::CUSTOMERS_PAGE:
+                customers->getCustomersPage(translate(0, e.text[0]), e.number,
+                                            static_cast<domain::PageDirection>(e.code[0]));
+                return true;
+            case OperationType::TICKETS_PAGE:
+                tickets->getTicketsPage(translate(0, e.text[0]), e.number,
+                                        static_cast<domain::PageDirection>(e.code[0]));
+                return true;
+        }
+        return false;
+    }
+};
+
+int main(int argc, char** argv) {
+    double speed = 1.0;  // 0 = as fast as possible
+    if (argc == 4 && std::strcmp(argv[2], "--speed") == 0) {
+        speed = std::strcmp(argv[3], "max") == 0 ? 0.0 : std::atof(argv[3]);
+    }
+    if ((argc != 2 && argc != 4) || speed < 0) {
+        std::fprintf(stderr, "usage: %s <trace> [--speed N|max]\n", argv[0]);
+        return 2;
+    }
+
+    infrastructure::TraceReader reader(argv[1]);
+    if (!reader.isValid()) {
+        std::fprintf(stderr, "%s is not an operation trace\n", argv[1]);
+        return 1;
+    }
+
+    auto& customerRepo = infrastructure::InMemoryCustomerRepository::getInstance();
+    auto& ticketRepo = infrastructure::InMemoryTicketRepository::getInstance();
+    auto& notifications = domain::NotificationService::getInstance();
+    Replayer replayer(std::make_shared<domain::CustomerService>(customerRepo, nullptr),
+                      std::make_shared<domain::TicketService>(ticketRepo, customerRepo,
+                                                              notifications, nullptr));
+
+    std::array<OperationStats, domain::kOperationTypes> stats;
+    domain::LatencyHistogram lag;  // how late calls started against the schedule
+    std::size_t operations = 0;
+    std::uint64_t traceSpanNs = 0;
+    infrastructure::TraceEntry entry;
+    auto start = Clock::now();
+    while (reader.next(entry)) {
+        auto issue = Clock::now();
+        if (speed > 0) {
+            auto due = start + std::chrono::nanoseconds(
+                static_cast<std::int64_t>(static_cast<double>(entry.startNs) / speed));
+            if (due > issue) {
+                std::this_thread::sleep_until(due);
+                issue = Clock::now();
+            }
+            lag.record(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(issue - due).count()));
+        }
+        bool ok = replayer.execute(entry);
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - issue).count();
+
+        auto& s = stats[static_cast<std::size_t>(entry.type)];
+        s.replayed.record(static_cast<std::uint64_t>(ns));
+        s.recorded.record(entry.durationNs);
+        if (ok != entry.ok) ++s.mismatches;
+        traceSpanNs = std::max(traceSpanNs, entry.startNs + entry.durationNs);
+        ++operations;
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    if (reader.truncated()) std::printf("trace ends in a partial record\n");
+    std::printf("%zu operations in %.3f s (trace spans %.3f s), %.0f ops/s\n",
+                operations, seconds, static_cast<double>(traceSpanNs) / 1e9,
+                static_cast<double>(operations) / seconds);
+    if (speed > 0) {
+        auto snap = lag.snapshot();
+        std::printf("schedule lag us: p50 %.1f  p99 %.1f  max %.1f\n",
+                    static_cast<double>(snap.percentile(50)) / 1000.0,
+                    static_cast<double>(snap.percentile(99)) / 1000.0,
+                    static_cast<double>(snap.max) / 1000.0);
+    }
+
+    std::printf("\n%-20s %10s %10s %10s %10s %10s %10s %10s\n", "operation", "count",
+                "mismatch", "p50 us", "p99 us", "max us", "rec p50", "rec p99");
+    for (std::size_t i = 0; i < stats.size(); ++i) {
+        auto replayed = stats[i].replayed.snapshot();
+        if (replayed.count == 0) continue;
+        auto recorded = stats[i].recorded.snapshot();
+        auto us = [](std::uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+        std::printf("%-20s %10llu %10zu %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+                    domain::operationName(static_cast<OperationType>(i)),
+                    static_cast<unsigned long long>(replayed.count), stats[i].mismatches,
+                    us(replayed.percentile(50)), us(replayed.percentile(99)), us(replayed.max),
+                    us(recorded.percentile(50)), us(recorded.percentile(99)));
+    }
+    return 0;
+}
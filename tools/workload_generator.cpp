@@ -0,0 +1,649 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "../src/domain/metrics/LatencyHistogram.hpp"
+#include "../src/domain/services/CustomerService.hpp"
+#include "../src/domain/services/NotificationService.hpp"
+#include "../src/domain/services/TicketService.hpp"
+#include "../src/infrastructure/net/Socket.hpp"
+#include "../src/infrastructure/repositories/InMemoryCustomerRepository.hpp"
+#include "../src/infrastructure/repositories/InMemoryTicketRepository.hpp"
+
+// Synthetic, production-shaped workload for capacity planning. Customers
+// are registered first with a configurable type mix. Then each thread
+// issues operations with Poisson arrivals at --rate:
+// - Ticket creation. Customers are picked from a Zipf distribution, so a
+//   few customers raise most tickets. Priority and category come from
+//   weighted mixes. Description lengths are log-normal.
+// - Status changes, which walk tickets through a Markov chain.
+// - Ticket reads.
+// Latency is measured from each operation's scheduled start, so a target
+// that falls behind shows up as latency instead of a lower request rate.
+// Every --report seconds it prints throughput, latency percentiles and
+// resident memory. The run ends with totals and memory per ticket.
+//
+// The target is the services in this process, or a server started with
+// `app --serve <address>` (line protocol; memory is read from
+// /proc/<--server-pid> when given). Ids assume the target starts empty.
+//
+// Usage: workload_generator [--connect <address> [--server-pid P]]
+//   [--customers N] [--tickets N] [--duration S] [--rate OPS] [--threads T]
+//   [--customer-mix R,P,V] [--priority-mix L,M,H,C] [--category-mix T,B,G,C,F]
+//   [--update-share X] [--read-share X] [--transitions 16 weights]
+//   [--zipf S] [--desc-median N] [--desc-sigma X] [--report S] [--seed N]
+
+using Clock = std::chrono::steady_clock;
+
+struct Config {
+    std::string connect;
+    long serverPid = 0;
+    std::size_t customers = 100000;
+    std::size_t tickets = 0;                 // 0 = until --duration
+    double duration = 10;
+    double rate = 0;                         // total ops/s, 0 = unthrottled
+    std::size_t threads = 1;
+    std::vector<double> customerMix{80, 15, 5};
+    std::vector<double> priorityMix{35, 40, 20, 5};
+    std::vector<double> categoryMix{30, 25, 25, 10, 10};
+    double updateShare = 0.5;
+    double readShare = 0.1;
+    // Row = current status, column = next status
+    // (OPEN, IN_PROGRESS, RESOLVED, CLOSED); an all-zero row is final.
+    std::vector<double> transitions{0, 85, 5, 10,
+                                    10, 0, 80, 10,
+                                    12, 0, 0, 88,
+                                    0, 0, 0, 0};
+    double zipf = 1.1;
+    double descMedian = 120;
+    double descSigma = 0.8;
+    double report = 1;
+    std::uint64_t seed = 42;
+};
+
+// Rejection-inversion sampler for Zipf(n, s), s != 1 (Hörmann and
+// Derflinger). Constant time and memory for any n.
+class ZipfSampler {
+private:
+    double exponent;
+    double hIntegralX1;
+    double hIntegralN;
+    double threshold;
+    std::uint64_t n;
+
+    static double helper1(double x) {
+        return std::abs(x) > 1e-8 ? std::log1p(x) / x : 1 - x * (0.5 - x * (1.0 / 3 - 0.25 * x));
+    }
+    static double helper2(double x) {
+        return std::abs(x) > 1e-8 ? std::expm1(x) / x : 1 + x * 0.5 * (1 + x / 3 * (1 + 0.25 * x));
+    }
+    double h(double x) const { return std::exp(-exponent * std::log(x)); }
+    double hIntegral(double x) const {
+        double logX = std::log(x);
+        return helper2((1 - exponent) * logX) * logX;
+    }
+    double hIntegralInverse(double x) const {
+        double t = std::max(x * (1 - exponent), -1.0);
+        return std::exp(helper1(t) * x);
+    }
+
+public:
+    ZipfSampler(std::uint64_t elements, double s)
+        : exponent(s == 1.0 ? 1.0001 : s), n(elements)
+    {
+        hIntegralX1 = hIntegral(1.5) - 1;
+        hIntegralN = hIntegral(static_cast<double>(n) + 0.5);
+        threshold = 2 - hIntegralInverse(hIntegral(2.5) - h(2));
+    }
+
+    // 0-based rank; 0 is the most frequent.
+    template <typename Rng>
+    std::uint64_t operator()(Rng& rng) {
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        for (;;) {
+            double u = hIntegralN + uniform(rng) * (hIntegralX1 - hIntegralN);
+            double x = hIntegralInverse(u);
+            auto k = static_cast<std::uint64_t>(std::clamp(x + 0.5, 1.0, static_cast<double>(n)));
+            if (static_cast<double>(k) - x <= threshold ||
+                u >= hIntegral(static_cast<double>(k) + 0.5) - h(static_cast<double>(k))) {
+                return k - 1;
+            }
+        }
+    }
+};
+
+// Operations against the services, in process or over a socket.
+class Target {
+public:
+    virtual ~Target() = default;
+    // Registers customers and returns the numeric part of the first id.
+    virtual long registerCustomers(const std::vector<domain::CustomerType>& types) = 0;
+    virtual bool createTicket(const std::string& customerId, std::string_view description,
+                              domain::Priority priority, domain::TicketCategory category,
+                              std::string& ticketId) = 0;
+    virtual bool updateStatus(const std::string& ticketId, domain::TicketStatus status) = 0;
+    virtual bool getTicket(const std::string& ticketId) = 0;
+};
+
+static long idNumber(std::string_view id) {
+    long value = -1;
+    auto dash = id.find('-');
+    if (dash != std::string_view::npos) {
+        std::from_chars(id.data() + dash + 1, id.data() + id.size(), value);
+    }
+    return value;
+}
+
+class DirectTarget : public Target {
+private:
+    domain::CustomerService& customers;
+    domain::TicketService& tickets;
+    std::string text;
+
+public:
+    DirectTarget(domain::CustomerService& cs, domain::TicketService& ts)
+        : customers(cs), tickets(ts) {}
+
+    long registerCustomers(const std::vector<domain::CustomerType>& types) override {
+        long first = -1;
+        for (auto type : types) {
+            long id = idNumber(customers.registerCustomer("Generated Customer",
+                                                         "customer@example.com", "555-0100", type));
+            if (first < 0 || id < first) first = id;
+        }
+        return first;
+    }
+
+    bool createTicket(const std::string& customerId, std::string_view description,
+                      domain::Priority priority, domain::TicketCategory category,
+                      std::string& ticketId) override
+    {
+        text.assign(description.data(), description.size());
+        ticketId = tickets.createTicket(customerId, text, priority, category);
+        return !ticketId.empty();
+    }
+
+    bool updateStatus(const std::string& ticketId, domain::TicketStatus status) override {
+        return tickets.updateTicketStatus(ticketId, status);
+    }
+
+    bool getTicket(const std::string& ticketId) override {
+        return tickets.getTicket(ticketId) != nullptr;
+    }
+};
+
+// Line protocol of `app --serve`, one request in flight; customer
+// registration is pipelined in chunks.
+class LineTarget : public Target {
+private:
+    int fd = -1;
+    std::string out;
+    std::string in;
+    std::size_t inStart = 0;
+
+    bool sendAll() {
+        std::size_t offset = 0;
+        while (offset < out.size()) {
+            ssize_t n = ::send(fd, out.data() + offset, out.size() - offset, MSG_NOSIGNAL);
+            if (n <= 0) return false;
+            offset += static_cast<std::size_t>(n);
+        }
+        out.clear();
+        return true;
+    }
+
+    // Next reply line, without the newline; empty view when the peer closed.
+    std::string_view readLine() {
+        for (;;) {
+            auto newline = in.find('\n', inStart);
+            if (newline != std::string::npos) {
+                std::string_view line(in.data() + inStart, newline - inStart);
+                inStart = newline + 1;
+                return line;
+            }
+            in.erase(0, inStart);
+            inStart = 0;
+            char buf[16384];
+            ssize_t n = ::read(fd, buf, sizeof(buf));
+            if (n <= 0) return {};
+            in.append(buf, static_cast<std::size_t>(n));
+        }
+    }
+
+public:
+    explicit LineTarget(const infrastructure::Endpoint& endpoint)
+        : fd(infrastructure::net::connectTo(endpoint)) {}
+
+    ~LineTarget() override {
+        if (fd >= 0) ::close(fd);
+    }
+
+    bool connected() const { return fd >= 0; }
+
+    long registerCustomers(const std::vector<domain::CustomerType>& types) override {
+        static constexpr std::size_t kChunk = 512;
+        long first = -1;
+        for (std::size_t begin = 0; begin < types.size(); begin += kChunk) {
+            std::size_t end = std::min(types.size(), begin + kChunk);
+            for (std::size_t i = begin; i < end; ++i) {
+                out += "customer|Generated Customer|customer@example.com|555-0100|";
+                out += static_cast<char>('0' + static_cast<int>(types[i]));
+                out += '\n';
+            }
+            if (!sendAll()) return -1;
+            for (std::size_t i = begin; i < end; ++i) {
+                auto line = readLine();
+                if (line.substr(0, 3) != "OK ") return -1;
+                long id = idNumber(line.substr(3));
+                if (first < 0 || id < first) first = id;
+            }
+        }
+        return first;
+    }
+
+    bool createTicket(const std::string& customerId, std::string_view description,
+                      domain::Priority priority, domain::TicketCategory category,
+                      std::string& ticketId) override
+    {
+        out += "ticket|";
+        out += customerId;
+        out += '|';
+        out += description;
+        out += '|';
+        out += static_cast<char>('0' + static_cast<int>(priority));
+        out += '|';
+        out += static_cast<char>('0' + static_cast<int>(category));
+        out += '\n';
+        if (!sendAll()) return false;
+        auto line = readLine();
+        if (line.substr(0, 3) != "OK ") return false;
+        ticketId.assign(line.substr(3));
+        return true;
+    }
+
+    bool updateStatus(const std::string& ticketId, domain::TicketStatus status) override {
+        out += "status|";
+        out += ticketId;
+        out += '|';
+        out += static_cast<char>('0' + static_cast<int>(status));
+        out += '\n';
+        return sendAll() && readLine() == "OK";
+    }
+
+    bool getTicket(const std::string& ticketId) override {
+        // The line protocol has no single-ticket read: list one ticket after
+        // a cursor that sorts just below the id.
+        out += "tickets|";
+        out += ticketId;
+        out.back() -= 1;
+        out += "~|1\n";
+        if (!sendAll()) return false;
+        bool found = false;
+        for (auto line = readLine(); !line.empty(); line = readLine()) {
+            if (line.substr(0, 3) == "OK " || line.substr(0, 4) == "ERR ") break;
+            found = line.size() > ticketId.size() && line.substr(0, ticketId.size()) == ticketId &&
+                    line[ticketId.size()] == '|';
+        }
+        return found;
+    }
+};
+
+enum OpKind { CREATE, UPDATE, READ, kOpKinds };
+
+struct Shared {
+    std::array<domain::LatencyHistogram, kOpKinds> latency;
+    std::array<std::atomic<std::uint64_t>, kOpKinds> completed{};
+    std::atomic<std::uint64_t> errors{0};
+    std::atomic<std::uint64_t> ticketsCreated{0};
+    std::atomic<bool> stop{false};
+};
+
+struct TrackedTicket {
+    std::string id;
+    domain::TicketStatus status;
+};
+
+static std::size_t residentBytes(long pid) {
+    char path[64];
+    std::snprintf(path, sizeof(path), pid ? "/proc/%ld/statm" : "/proc/self/statm", pid);
+    FILE* f = std::fopen(path, "r");
+    if (!f) return 0;
+    unsigned long size = 0, resident = 0;
+    int fields = std::fscanf(f, "%lu %lu", &size, &resident);
+    std::fclose(f);
+    return fields == 2 ? resident * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)) : 0;
+}
+
+static std::string makeCorpus(std::size_t size) {
+    static const char* const words[] = {
+        "printer", "error", "login", "fails", "after", "the", "nightly", "update", "invoice",
+        "shows", "wrong", "amount", "please", "help", "urgent", "customer", "cannot", "access",
+        "account", "page", "loads", "slowly", "since", "monday", "refund", "request", "for",
+        "order", "missing", "item", "in", "delivery", "app", "crashes", "on", "startup"};
+    std::mt19937_64 rng(7);
+    std::string corpus;
+    while (corpus.size() < size) {
+        corpus += words[rng() % (sizeof(words) / sizeof(words[0]))];
+        corpus += ' ';
+    }
+    return corpus;
+}
+
+static void runWorker(const Config& config, Target& target, long firstCustomer,
+                      std::size_t index, const std::string& corpus, Shared& shared)
+{
+    static constexpr std::size_t kTracked = 1 << 16;
+    std::mt19937_64 rng(config.seed * 1000003 + index);
+    ZipfSampler customerRank(config.customers, config.zipf);
+    std::discrete_distribution<int> priority(config.priorityMix.begin(), config.priorityMix.end());
+    std::discrete_distribution<int> category(config.categoryMix.begin(), config.categoryMix.end());
+    std::array<std::discrete_distribution<int>, 4> next;
+    std::array<bool, 4> final{};
+    for (int s = 0; s < 4; ++s) {
+        auto row = config.transitions.begin() + s * 4;
+        final[s] = std::all_of(row, row + 4, [](double w) { return w <= 0; });
+        if (!final[s]) next[s] = std::discrete_distribution<int>(row, row + 4);
+    }
+    std::lognormal_distribution<double> descLength(std::log(config.descMedian), config.descSigma);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    double perThreadRate = config.rate / static_cast<double>(config.threads);
+    std::exponential_distribution<double> gap(perThreadRate > 0 ? perThreadRate : 1.0);
+
+    std::vector<TrackedTicket> tracked;
+    tracked.reserve(kTracked);
+    std::size_t replace = 0;
+    std::string customerId;
+    std::string ticketId;
+    char digits[24];
+
+    auto due = Clock::now();
+    while (!shared.stop.load(std::memory_order_relaxed)) {
+        if (perThreadRate > 0) {
+            due += std::chrono::nanoseconds(static_cast<std::int64_t>(gap(rng) * 1e9));
+            std::this_thread::sleep_until(due);
+        } else {
+            due = Clock::now();
+        }
+
+        double pick = uniform(rng);
+        OpKind kind = CREATE;
+        if (!tracked.empty() && pick < config.updateShare) kind = UPDATE;
+        else if (!tracked.empty() && pick < config.updateShare + config.readShare) kind = READ;
+
+        bool ok = true;
+        if (kind == CREATE) {
+            auto rank = customerRank(rng);
+            auto end = std::to_chars(digits, digits + sizeof(digits),
+                                     firstCustomer + static_cast<long>(rank)).ptr;
+            customerId.assign("CUST-").append(digits, end);
+            auto length = static_cast<std::size_t>(std::clamp(descLength(rng), 8.0, 4000.0));
+            std::size_t offset = rng() % (corpus.size() - length);
+            ok = target.createTicket(customerId, std::string_view(corpus).substr(offset, length),
+                                     static_cast<domain::Priority>(priority(rng)),
+                                     static_cast<domain::TicketCategory>(category(rng)), ticketId);
+            if (ok) {
+                TrackedTicket t{ticketId, domain::TicketStatus::OPEN};
+                if (tracked.size() < kTracked) tracked.push_back(std::move(t));
+                else tracked[replace++ % kTracked] = std::move(t);
+                shared.ticketsCreated.fetch_add(1, std::memory_order_relaxed);
+            }
+        } else {
+            std::size_t slot = rng() % tracked.size();
+            auto& t = tracked[slot];
+            if (kind == READ) {
+                ok = target.getTicket(t.id);
+            } else {
+                auto from = static_cast<int>(t.status);
+                auto to = static_cast<domain::TicketStatus>(next[from](rng));
+                ok = target.updateStatus(t.id, to);
+                t.status = to;
+                if (final[static_cast<int>(to)]) {
+                    t = std::move(tracked.back());
+                    tracked.pop_back();
+                }
+            }
+        }
+
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - due).count();
+        shared.latency[kind].record(static_cast<std::uint64_t>(ns));
+        shared.completed[kind].fetch_add(1, std::memory_order_relaxed);
+        if (!ok) shared.errors.fetch_add(1, std::memory_order_relaxed);
+        if (config.tickets && shared.ticketsCreated.load(std::memory_order_relaxed) >= config.tickets) {
+            shared.stop.store(true, std::memory_order_relaxed);
+        }
+    }
+}
+
+// Histogram of the values recorded between two snapshots.
+static domain::HistogramSnapshot since(const domain::HistogramSnapshot& now,
+                                       const domain::HistogramSnapshot& before)
+{
+    domain::HistogramSnapshot d = now;
+    d.count = now.count - before.count;
+    d.sum = now.sum - before.sum;
+    for (std::size_t i = 0; i < d.buckets.size(); ++i) d.buckets[i] -= before.buckets[i];
+    return d;
+}
+
+static domain::HistogramSnapshot merged(Shared& shared) {
+    domain::HistogramSnapshot all = shared.latency[0].snapshot();
+    for (std::size_t k = 1; k < kOpKinds; ++k) {
+        auto s = shared.latency[k].snapshot();
+        all.count += s.count;
+        all.sum += s.sum;
+        all.max = std::max(all.max, s.max);
+        for (std::size_t i = 0; i < all.buckets.size(); ++i) all.buckets[i] += s.buckets[i];
+    }
+    return all;
+}
+
+static bool parseList(const char* text, std::size_t expected, std::vector<double>& out) {
+    std::vector<double> values;
+    for (const char* p = text; *p;) {
+        char* end;
+        values.push_back(std::strtod(p, &end));
+        if (end == p || values.back() < 0) return false;
+        p = *end == ',' ? end + 1 : end;
+        if (*end && *end != ',') return false;
+    }
+    if (values.size() != expected) return false;
+    out = values;
+    return true;
+}
+
+static bool parseConfig(int argc, char** argv, Config& c) {
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string flag = argv[i];
+        const char* v = argv[i + 1];
+        bool ok = true;
+        if (flag == "--connect") c.connect = v;
+        else if (flag == "--server-pid") c.serverPid = std::atol(v);
+        else if (flag == "--customers") c.customers = std::strtoull(v, nullptr, 10);
+        else if (flag == "--tickets") c.tickets = std::strtoull(v, nullptr, 10);
+        else if (flag == "--duration") c.duration = std::atof(v);
+        else if (flag == "--rate") c.rate = std::atof(v);
+        else if (flag == "--threads") c.threads = std::strtoul(v, nullptr, 10);
+        else if (flag == "--customer-mix") ok = parseList(v, 3, c.customerMix);
+        else if (flag == "--priority-mix") ok = parseList(v, 4, c.priorityMix);
+        else if (flag == "--category-mix") ok = parseList(v, 5, c.categoryMix);
+        else if (flag == "--transitions") ok = parseList(v, 16, c.transitions);
+        else if (flag == "--update-share") c.updateShare = std::atof(v);
+        else if (flag == "--read-share") c.readShare = std::atof(v);
+        else if (flag == "--zipf") c.zipf = std::atof(v);
+        else if (flag == "--desc-median") c.descMedian = std::atof(v);
+        else if (flag == "--desc-sigma") c.descSigma = std::atof(v);
+        else if (flag == "--report") c.report = std::atof(v);
+        else if (flag == "--seed") c.seed = std::strtoull(v, nullptr, 10);
+        else ok = false;
+        if (!ok) {
+            std::fprintf(stderr, "invalid %s %s\n", flag.c_str(), v);
+            return false;
+        }
+    }
+    return argc % 2 == 1 && c.customers > 0 && c.threads > 0 && c.report > 0 &&
+           c.zipf > 0 && c.descMedian >= 8 && c.updateShare + c.readShare <= 1;
+}
+
+int main(int argc, char** argv) {
+    Config config;
+    if (!parseConfig(argc, argv, config)) {
+        std::fprintf(stderr, "usage: see the comment at the top of tools/workload_generator.cpp\n");
+        return 2;
+    }
+
+    // Targets, one per thread
+    auto& customerRepo = infrastructure::InMemoryCustomerRepository::getInstance();
+    auto& ticketRepo = infrastructure::InMemoryTicketRepository::getInstance();
+    auto& notifications = domain::NotificationService::getInstance();
+    domain::CustomerService customerService(customerRepo, nullptr);
+    domain::TicketService ticketService(ticketRepo, customerRepo, notifications, nullptr);
+
+    infrastructure::Endpoint endpoint;
+    bool remote = !config.connect.empty();
+    if (remote && !infrastructure::Endpoint::parse(config.connect, endpoint)) {
+        std::fprintf(stderr, "invalid address %s\n", config.connect.c_str());
+        return 2;
+    }
+    std::vector<std::unique_ptr<Target>> targets;
+    for (std::size_t i = 0; i < config.threads; ++i) {
+        if (remote) {
+            auto target = std::make_unique<LineTarget>(endpoint);
+            if (!target->connected()) {
+                std::fprintf(stderr, "cannot connect to %s\n", config.connect.c_str());
+                return 1;
+            }
+            targets.push_back(std::move(target));
+        } else {
+            targets.push_back(std::make_unique<DirectTarget>(customerService, ticketService));
+        }
+    }
+    long pid = remote ? config.serverPid : 0;
+    bool haveMemory = !remote || pid > 0;
+    std::size_t rssStart = residentBytes(pid);
+
+    // Customers, split across threads
+    std::printf("registering %zu customers (mix %g/%g/%g)...\n", config.customers,
+                config.customerMix[0], config.customerMix[1], config.customerMix[2]);
+    std::fflush(stdout);
+    auto loadStart = Clock::now();
+    std::vector<long> firsts(config.threads, -1);
+    {
+        std::vector<std::thread> loaders;
+        for (std::size_t t = 0; t < config.threads; ++t) {
+            loaders.emplace_back([&, t] {
+                std::mt19937_64 rng(config.seed + t);
+                std::discrete_distribution<int> type(config.customerMix.begin(),
+                                                     config.customerMix.end());
+                std::size_t count = config.customers / config.threads +
+                                    (t < config.customers % config.threads ? 1 : 0);
+                std::vector<domain::CustomerType> types(count);
+                for (auto& v : types) v = static_cast<domain::CustomerType>(type(rng));
+                firsts[t] = targets[t]->registerCustomers(types);
+            });
+        }
+        for (auto& l : loaders) l.join();
+    }
+    long firstCustomer = -1;
+    for (long f : firsts) {
+        if (f >= 0 && (firstCustomer < 0 || f < firstCustomer)) firstCustomer = f;
+    }
+    if (firstCustomer < 0) {
+        std::fprintf(stderr, "customer registration failed\n");
+        return 1;
+    }
+    double loadSeconds = std::chrono::duration<double>(Clock::now() - loadStart).count();
+    std::size_t rssCustomers = residentBytes(pid);
+    std::printf("registered in %.2f s (%.0f/s)", loadSeconds,
+                static_cast<double>(config.customers) / loadSeconds);
+    if (haveMemory) {
+        std::printf(", rss %.1f MB (%.0f B/customer)", static_cast<double>(rssCustomers) / 1e6,
+                    static_cast<double>(rssCustomers - std::min(rssStart, rssCustomers)) /
+                        static_cast<double>(config.customers));
+    }
+    std::printf("\n\n%8s %10s %10s %10s %10s %10s %10s %12s %10s\n", "time s", "ops/s",
+                "p50 us", "p99 us", "p99.9 us", "max us", "errors", "tickets", "rss MB");
+
+    // Workload
+    Shared shared;
+    std::string corpus = makeCorpus(1 << 16);
+    std::vector<std::thread> workers;
+    auto start = Clock::now();
+    for (std::size_t t = 0; t < config.threads; ++t) {
+        workers.emplace_back(runWorker, std::cref(config), std::ref(*targets[t]), firstCustomer, t,
+                             std::cref(corpus), std::ref(shared));
+    }
+
+    auto previous = merged(shared);
+    std::uint64_t previousOps = 0;
+    auto tick = start;
+    while (!shared.stop.load(std::memory_order_relaxed)) {
+        tick += std::chrono::nanoseconds(static_cast<std::int64_t>(config.report * 1e9));
+        while (Clock::now() < tick && !shared.stop.load(std::memory_order_relaxed)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        if (!config.tickets && elapsed >= config.duration) shared.stop.store(true);
+
+        auto now = merged(shared);
+        auto interval = since(now, previous);
+        std::uint64_t ops = now.count;
+        auto us = [&](double p) { return static_cast<double>(interval.percentile(p)) / 1000.0; };
+        std::printf("%8.1f %10.0f %10.1f %10.1f %10.1f %10.1f %10llu %12llu",
+                    elapsed, static_cast<double>(ops - previousOps) / config.report,
+                    us(50), us(99), us(99.9),
+                    static_cast<double>(interval.count ? interval.percentile(100) : 0) / 1000.0,
+                    static_cast<unsigned long long>(shared.errors.load()),
+                    static_cast<unsigned long long>(shared.ticketsCreated.load()));
+        if (haveMemory) std::printf(" %10.1f", static_cast<double>(residentBytes(pid)) / 1e6);
+        std::printf("\n");
+        std::fflush(stdout);
+        previous = std::move(now);
+        previousOps = ops;
+    }
+    for (auto& w : workers) w.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // Summary
+    std::size_t rssEnd = residentBytes(pid);
+    std::uint64_t created = shared.ticketsCreated.load();
+    auto all = merged(shared);
+    std::printf("\nsustained %.0f ops/s over %.1f s, %llu tickets created, %llu errors\n",
+                static_cast<double>(all.count) / seconds, seconds,
+                static_cast<unsigned long long>(created),
+                static_cast<unsigned long long>(shared.errors.load()));
+    static const char* const names[kOpKinds] = {"create", "update", "read"};
+    std::printf("%-8s %12s %10s %10s %10s %10s\n", "op", "count", "p50 us", "p99 us",
+                "p99.9 us", "max us");
+    for (std::size_t k = 0; k < kOpKinds; ++k) {
+        auto s = shared.latency[k].snapshot();
+        std::printf("%-8s %12llu %10.1f %10.1f %10.1f %10.1f\n", names[k],
+                    static_cast<unsigned long long>(s.count),
+                    static_cast<double>(s.percentile(50)) / 1000.0,
+                    static_cast<double>(s.percentile(99)) / 1000.0,
+                    static_cast<double>(s.percentile(99.9)) / 1000.0,
+                    static_cast<double>(s.max) / 1000.0);
+    }
+    if (haveMemory && created > 0) {
+        std::printf("memory: rss %.1f MB -> %.1f MB, %.0f B/ticket\n",
+                    static_cast<double>(rssCustomers) / 1e6, static_cast<double>(rssEnd) / 1e6,
+                    static_cast<double>(rssEnd - std::min(rssCustomers, rssEnd)) /
+                        static_cast<double>(created));
+    }
+    return 0;
+}